@@ -0,0 +1,88 @@
+#include "benchmark.hpp"
+#include "strict_types/algorithm.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Paired microbenchmarks of bulk std::fill/std::copy over raw built-ins and over
+// the equivalent strict type, and of the strict_types fill/copy/zero helpers.
+// std algorithms only reach their memset/memmove fast paths when the element type
+// is trivially copyable, which STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS guarantees;
+// a ratio close to 1.0 means the strict type takes the same path as the raw type.
+
+constexpr std::size_t element_count = 1 << 20;
+
+// Benchmarks filling with [fill_value], copying and zeroing as raw std algorithms,
+// strict std algorithms, and strict_types helpers.
+template <typename Strict>
+void benchmark_algorithms(const std::string_view title, const typename Strict::type fill_value) {
+	using raw_t = typename Strict::type;
+
+	benchmark::report_header(title);
+
+	std::vector<raw_t>  raw_source(element_count, fill_value);
+	std::vector<raw_t>  raw_destination(element_count);
+	std::vector<Strict> strict_source(element_count, static_cast<Strict>(fill_value));
+	std::vector<Strict> strict_destination(element_count);
+
+	const double raw_fill = benchmark::measure([&] {
+		std::fill(raw_destination.begin(), raw_destination.end(), fill_value);
+		benchmark::do_not_optimize(raw_destination.data());
+	}, element_count);
+
+	const double std_fill = benchmark::measure([&] {
+		std::fill(strict_destination.begin(), strict_destination.end(), static_cast<Strict>(fill_value));
+		benchmark::do_not_optimize(strict_destination.data());
+	}, element_count);
+
+	const double strict_fill = benchmark::measure([&] {
+		STRICT_TYPES_NAMESPACE::fill(strict_destination, static_cast<Strict>(fill_value));
+		benchmark::do_not_optimize(strict_destination.data());
+	}, element_count);
+
+	const double raw_zero = benchmark::measure([&] {
+		std::fill(raw_destination.begin(), raw_destination.end(), raw_t {});
+		benchmark::do_not_optimize(raw_destination.data());
+	}, element_count);
+
+	const double strict_zero = benchmark::measure([&] {
+		STRICT_TYPES_NAMESPACE::zero(strict_destination);
+		benchmark::do_not_optimize(strict_destination.data());
+	}, element_count);
+
+	const double raw_copy = benchmark::measure([&] {
+		std::copy(raw_source.begin(), raw_source.end(), raw_destination.begin());
+		benchmark::do_not_optimize(raw_destination.data());
+	}, element_count);
+
+	const double std_copy = benchmark::measure([&] {
+		std::copy(strict_source.begin(), strict_source.end(), strict_destination.begin());
+		benchmark::do_not_optimize(strict_destination.data());
+	}, element_count);
+
+	const double strict_copy = benchmark::measure([&] {
+		STRICT_TYPES_NAMESPACE::copy(strict_source, strict_destination);
+		benchmark::do_not_optimize(strict_destination.data());
+	}, element_count);
+
+	benchmark::report("std::fill", raw_fill, std_fill);
+	benchmark::report("strict::fill", raw_fill, strict_fill);
+	benchmark::report("strict::zero", raw_zero, strict_zero);
+	benchmark::report("std::copy", raw_copy, std_copy);
+	benchmark::report("strict::copy", raw_copy, strict_copy);
+}
+
+int main() {
+	benchmark_algorithms<STRICT_TYPES_NAMESPACE::byte_t>("std::uint8_t vs strict::byte_t", 0x5A);
+	benchmark_algorithms<STRICT_TYPES_NAMESPACE::uint16_t>("std::uint16_t vs strict::uint16_t", 0x1234);
+	benchmark_algorithms<STRICT_TYPES_NAMESPACE::int32_t>("std::int32_t vs strict::int32_t", -1);
+	benchmark_algorithms<STRICT_TYPES_NAMESPACE::uint64_t>("std::uint64_t vs strict::uint64_t", 0x0123456789ABCDEFULL);
+	benchmark_algorithms<STRICT_TYPES_NAMESPACE::double_t>("double vs strict::double_t", 1.5);
+
+	return 0;
+}
@@ -0,0 +1,85 @@
+#include "benchmark.hpp"
+#include "strict_types/alias.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Paired microbenchmarks of the container accessors forwarded by strict alias
+// types, over a vector of heap-allocated strings. The accessors return what the
+// encapsulated container returns, so front(), back() and operator[] yield
+// references instead of copies; a ratio close to 1.0 means no string is copied.
+// The "by-value copy" row shows what a copying accessor costs for comparison.
+
+constexpr std::size_t element_count = 1 << 14;
+
+STRICT_TYPES_DEFINE_ALIAS_TYPE(name_list_t, std::vector<std::string>)
+
+using name_list = STRICT_TYPES_NAMESPACE::name_list_t;
+
+// Returns [count] strings too long for the small-string optimization.
+std::vector<std::string> make_names(const std::size_t count) {
+	std::vector<std::string> names(count);
+
+	for (std::size_t i = 0; i < count; ++i) names[i] = "metric.request.latency." + std::to_string(i);
+
+	return names;
+}
+
+int main() {
+	benchmark::report_header("std::vector<std::string> vs strict alias");
+
+	std::vector<std::vector<std::string>> raw(element_count, make_names(4));
+	std::vector<name_list>					  strict(element_count, name_list(make_names(4)));
+
+	const double raw_front = benchmark::measure([&] {
+		std::size_t total = 0;
+		for (const std::vector<std::string>& names : raw) total += names.front().size() + names.back().size();
+		benchmark::do_not_optimize(total);
+	}, element_count);
+
+	const double strict_front = benchmark::measure([&] {
+		std::size_t total = 0;
+		for (const name_list& names : strict) total += names.front().size() + names.back().size();
+		benchmark::do_not_optimize(total);
+	}, element_count);
+
+	const double copy_front = benchmark::measure([&] {
+		std::size_t total = 0;
+		for (const std::vector<std::string>& names : raw) {
+			const std::string front	= names.front();
+			const std::string back	= names.back();
+			total += front.size() + back.size();
+		}
+		benchmark::do_not_optimize(total);
+	}, element_count);
+
+	const double raw_subscript = benchmark::measure([&] {
+		std::size_t total = 0;
+		for (const std::vector<std::string>& names : raw) total += names[1].size() + names[2].size();
+		benchmark::do_not_optimize(total);
+	}, element_count);
+
+	const double strict_subscript = benchmark::measure([&] {
+		std::size_t total = 0;
+		for (const name_list& names : strict) total += names[std::size_t {1}].size() + names[std::size_t {2}].size();
+		benchmark::do_not_optimize(total);
+	}, element_count);
+
+	const double raw_write = benchmark::measure([&] {
+		for (std::vector<std::string>& names : raw) names.front()[0] ^= 1;
+		benchmark::do_not_optimize(raw.data());
+	}, element_count);
+
+	const double strict_write = benchmark::measure([&] {
+		for (name_list& names : strict) names.front()[0] ^= 1;
+		benchmark::do_not_optimize(strict.data());
+	}, element_count);
+
+	benchmark::report("front()/back()", raw_front, strict_front);
+	benchmark::report("front()/back() by-value copy", raw_front, copy_front);
+	benchmark::report("operator[]", raw_subscript, strict_subscript);
+	benchmark::report("front() write", raw_write, strict_write);
+
+	return 0;
+}
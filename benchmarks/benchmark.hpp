@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+/*
+	benchmark.hpp description:
+		This header file contains a minimal benchmarking harness shared by the
+		strict_types benchmarks. A benchmark runs a kernel several times and
+		keeps the fastest run, so paired raw/strict kernels can be compared
+		side by side without depending on an external benchmarking library.
+*/
+
+namespace benchmark {
+	/// @brief Prevents the optimizer from discarding a value, or the work that produced it.
+	/// @tparam Type The value type.
+	/// @param value The value to keep alive.
+	template <typename Type>
+	inline void do_not_optimize(const Type& value) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		static const volatile void* sink;
+		sink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	/// @brief Returns the fastest run of [kernel] in nanoseconds per element.
+	/// @tparam Kernel The benchmarked callable, invoked without arguments.
+	/// @param elements The number of elements a single [kernel] invocation processes.
+	/// @param repetitions The number of timed runs.
+	/// @returns double
+	template <typename Kernel>
+	inline double measure(Kernel&& kernel, const std::size_t elements, const std::size_t repetitions = 25) {
+		using clock = std::chrono::steady_clock;
+
+		double fastest = 0.0;
+
+		kernel();
+
+		for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+			const auto begin = clock::now();
+			kernel();
+			const auto end = clock::now();
+
+			const double elapsed = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(elements);
+
+			fastest = (repetition == 0) ? elapsed : std::min(fastest, elapsed);
+		}
+
+		return fastest;
+	}
+
+	/// @brief Prints the table header used by report().
+	inline void report_header(const std::string_view title) {
+		std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+		std::printf("%-28s %12s %12s %8s\n", "operation", "raw ns/op", "strict ns/op", "ratio");
+	}
+
+	/// @brief Prints one paired raw/strict result row.
+	inline void report(const std::string_view name, const double raw, const double strict) {
+		std::printf("%-28.*s %12.4f %12.4f %8.3f\n", static_cast<int>(name.size()), name.data(), raw, strict, raw > 0.0 ? strict / raw : 0.0);
+	}
+}
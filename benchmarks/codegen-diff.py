@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+"""
+codegen-diff.py description:
+	Compiles codegen-kernels.cpp to assembly and verifies that every strict_<name>
+	kernel emits exactly the same instruction sequence as its raw_<name> counterpart.
+	Instructions are compared in full, with register names reduced to their class and
+	width and local labels renamed by order of appearance, and register-to-register
+	moves are skipped: register allocation and the operand order of commutative
+	operations are not overhead, while any extra, missing or different instruction,
+	immediate, displacement or memory operand is. Exits with a non-zero status and
+	prints both listings on any difference.
+
+Usage:
+	codegen-diff.py <source> <optimization> -- <compiler command and flags...>
+"""
+
+import re
+import subprocess
+import sys
+
+LABEL = re.compile(r'^_?(raw|strict)_(\w+):')
+LOCAL_LABEL = re.compile(r'\.?L\w*\d+')
+REGISTER = re.compile(r'^(%\w+|[xwvqdsbh]\d+(\.\w+)?|sp|xzr|wzr)$')
+X86_REGISTER = re.compile(r'%(\w+)')
+ARM_REGISTER = re.compile(r'\b([xwvqdsbh])\d+\b')
+
+# x86-64 register names by width, for the registers not named r<n>[dwb].
+X86_WIDTHS = {
+	**{name: 'r64' for name in ('rax', 'rbx', 'rcx', 'rdx', 'rsi', 'rdi', 'rbp', 'rsp')},
+	**{name: 'r32' for name in ('eax', 'ebx', 'ecx', 'edx', 'esi', 'edi', 'ebp', 'esp')},
+	**{name: 'r16' for name in ('ax', 'bx', 'cx', 'dx', 'si', 'di', 'bp', 'sp')},
+	**{name: 'r8' for name in ('al', 'bl', 'cl', 'dl', 'sil', 'dil', 'bpl', 'spl', 'ah', 'bh', 'ch', 'dh')},
+}
+
+
+def compile_to_assembly(source, optimization, compiler):
+	command = compiler + [
+		optimization,
+		'-S',
+		'-o',
+		'-',
+		'-fno-asynchronous-unwind-tables',
+		'-fno-exceptions',
+		'-fno-stack-protector',
+		source,
+	]
+
+	result = subprocess.run(command, capture_output=True, text=True)
+
+	if result.returncode != 0:
+		sys.stderr.write(result.stderr)
+		sys.exit(result.returncode)
+
+	return result.stdout
+
+
+def split_kernels(assembly):
+	"""Returns {name: {'raw': [...], 'strict': [...]}} of normalized instruction lines."""
+	kernels = {}
+	current = None
+
+	for line in assembly.splitlines():
+		label = LABEL.match(line)
+
+		if label:
+			kind, name = label.groups()
+			current = kernels.setdefault(name, {}).setdefault(kind, [])
+			continue
+
+		if current is None:
+			continue
+
+		instruction = line.split('#')[0].split('//')[0].strip()
+
+		if not instruction or instruction.endswith(':') or instruction.startswith('.'):
+			if instruction.startswith('.size') or instruction.startswith('.cfi_endproc'):
+				current = None
+			continue
+
+		current.append(' '.join(instruction.split()))
+
+	return kernels
+
+
+def normalize_local_labels(instructions):
+	"""Renames local jump labels by order of appearance so both listings read alike."""
+	names = {}
+
+	def rename(match):
+		return names.setdefault(match.group(0), f'.L{len(names)}')
+
+	return [LOCAL_LABEL.sub(rename, instruction) for instruction in instructions]
+
+
+def x86_register_class(match):
+	name = match.group(1)
+
+	if name in X86_WIDTHS:
+		return '%' + X86_WIDTHS[name]
+
+	numbered = re.fullmatch(r'r\d+([dwb]?)', name)
+
+	if numbered:
+		return '%' + {'': 'r64', 'd': 'r32', 'w': 'r16', 'b': 'r8'}[numbered.group(1)]
+
+	# Vector and other registers keep their class: %xmm3 -> %xmm.
+	return '%' + re.sub(r'\d+$', '', name)
+
+
+def normalize_registers(instruction):
+	"""Reduces register names to their class and width, keeping every other operand."""
+	mnemonic, _, operands = instruction.partition(' ')
+	operands = X86_REGISTER.sub(x86_register_class, operands)
+	operands = ARM_REGISTER.sub(lambda match: match.group(1), operands)
+
+	return f'{mnemonic} {operands}'.strip()
+
+
+def is_register_move(instruction):
+	mnemonic, _, operands = instruction.partition(' ')
+
+	if not mnemonic.startswith('mov'):
+		return False
+
+	return all(REGISTER.match(operand.strip()) for operand in operands.split(','))
+
+
+def comparable(instructions):
+	return [normalize_registers(instruction) for instruction in instructions if not is_register_move(instruction)]
+
+
+def main():
+	if len(sys.argv) < 5 or sys.argv[3] != '--':
+		sys.stderr.write(__doc__)
+		return 2
+
+	source, optimization, compiler = sys.argv[1], sys.argv[2], sys.argv[4:]
+
+	kernels = split_kernels(compile_to_assembly(source, optimization, compiler))
+	failures = 0
+
+	for name, pair in sorted(kernels.items()):
+		if 'raw' not in pair or 'strict' not in pair:
+			print(f'{name}: missing raw or strict kernel')
+			failures += 1
+			continue
+
+		raw = normalize_local_labels(pair['raw'])
+		strict = normalize_local_labels(pair['strict'])
+
+		if comparable(raw) == comparable(strict):
+			print(f'{name}: identical ({len(raw)} instructions)')
+			continue
+
+		failures += 1
+		print(f'{name}: DIFFERENT')
+		print('  raw:\n    ' + '\n    '.join(raw))
+		print('  strict:\n    ' + '\n    '.join(strict))
+
+	if not kernels:
+		print('no kernels found in the generated assembly')
+		return 1
+
+	print(f'\n{len(kernels) - failures}/{len(kernels)} kernels identical at {optimization}')
+
+	return 1 if failures else 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,138 @@
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Paired raw/strict kernels inspected by codegen-diff.py. Every kernel named
+// raw_<name> must compile to exactly the same instructions as strict_<name>.
+// The kernels use C linkage so their assembly labels are predictable.
+
+#if defined(__clang__)
+	#pragma clang diagnostic ignored "-Wreturn-type-c-linkage"
+#endif
+
+// Defines a scalar kernel pair returning [OP] applied to two operands.
+#define CODEGEN_SCALAR_KERNEL(NAME, OP, RAW, STRICT)                                                                 \
+	extern "C" RAW	  raw_##NAME(const RAW left, const RAW right) noexcept { return static_cast<RAW>(left OP right); } \
+	extern "C" STRICT strict_##NAME(const STRICT left, const STRICT right) noexcept { return left OP right; }
+
+// Defines a scalar kernel pair returning [OP] applied to a strict and a raw operand.
+#define CODEGEN_LEFT_ONLY_KERNEL(NAME, OP, RAW, STRICT)                                                              \
+	extern "C" RAW	  raw_##NAME(const RAW left, const RAW right) noexcept { return static_cast<RAW>(left OP right); } \
+	extern "C" STRICT strict_##NAME(const STRICT left, const RAW right) noexcept { return left OP right; }
+
+// Defines a scalar kernel pair comparing two operands with [OP].
+#define CODEGEN_COMPARISON_KERNEL(NAME, OP, RAW, STRICT)                                                   \
+	extern "C" bool raw_##NAME(const RAW left, const RAW right) noexcept { return left OP right; }          \
+	extern "C" bool strict_##NAME(const STRICT left, const STRICT right) noexcept { return left OP right; }
+
+// Defines a loop kernel pair applying [OP] element-wise, which exercises vectorization.
+#define CODEGEN_LOOP_KERNEL(NAME, OP, RAW, STRICT)                                                                         \
+	extern "C" void raw_##NAME(RAW* out, const RAW* left, const RAW* right, const std::size_t count) noexcept {             \
+		for (std::size_t i = 0; i < count; ++i) out[i] = static_cast<RAW>(left[i] OP right[i]);                              \
+	}                                                                                                                       \
+	extern "C" void strict_##NAME(STRICT* out, const STRICT* left, const STRICT* right, const std::size_t count) noexcept { \
+		for (std::size_t i = 0; i < count; ++i) out[i] = left[i] OP right[i];                                                \
+	}
+
+// Defines a loop kernel pair applying the compound assignment [OP]= element-wise.
+#define CODEGEN_COMPOUND_LOOP_KERNEL(NAME, OP, RAW, STRICT)                                            \
+	extern "C" void raw_##NAME(RAW* out, const RAW* right, const std::size_t count) noexcept {          \
+		for (std::size_t i = 0; i < count; ++i) out[i] OP## = right[i];                                  \
+	}                                                                                                   \
+	extern "C" void strict_##NAME(STRICT* out, const STRICT* right, const std::size_t count) noexcept { \
+		for (std::size_t i = 0; i < count; ++i) out[i] OP## = right[i];                                  \
+	}
+
+#define CODEGEN_INTEGRAL_KERNELS(SUFFIX, RAW, STRICT)                     \
+	CODEGEN_SCALAR_KERNEL(add_##SUFFIX, +, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(sub_##SUFFIX, -, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(mul_##SUFFIX, *, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(div_##SUFFIX, /, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(mod_##SUFFIX, %, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(and_##SUFFIX, &, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(or_##SUFFIX, |, RAW, STRICT)                     \
+	CODEGEN_SCALAR_KERNEL(xor_##SUFFIX, ^, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(shl_##SUFFIX, <<, RAW, STRICT)                   \
+	CODEGEN_SCALAR_KERNEL(shr_##SUFFIX, >>, RAW, STRICT)                   \
+	CODEGEN_LEFT_ONLY_KERNEL(add_raw_##SUFFIX, +, RAW, STRICT)             \
+	CODEGEN_LEFT_ONLY_KERNEL(mul_raw_##SUFFIX, *, RAW, STRICT)             \
+	CODEGEN_LEFT_ONLY_KERNEL(shl_raw_##SUFFIX, <<, RAW, STRICT)            \
+	CODEGEN_COMPARISON_KERNEL(eq_##SUFFIX, ==, RAW, STRICT)                \
+	CODEGEN_COMPARISON_KERNEL(ne_##SUFFIX, !=, RAW, STRICT)                \
+	CODEGEN_COMPARISON_KERNEL(gt_##SUFFIX, >, RAW, STRICT)                 \
+	CODEGEN_COMPARISON_KERNEL(lt_##SUFFIX, <, RAW, STRICT)                 \
+	CODEGEN_COMPARISON_KERNEL(ge_##SUFFIX, >=, RAW, STRICT)                \
+	CODEGEN_COMPARISON_KERNEL(le_##SUFFIX, <=, RAW, STRICT)                \
+	CODEGEN_LOOP_KERNEL(add_loop_##SUFFIX, +, RAW, STRICT)                 \
+	CODEGEN_LOOP_KERNEL(mul_loop_##SUFFIX, *, RAW, STRICT)                 \
+	CODEGEN_LOOP_KERNEL(xor_loop_##SUFFIX, ^, RAW, STRICT)                 \
+	CODEGEN_COMPOUND_LOOP_KERNEL(add_assign_loop_##SUFFIX, +, RAW, STRICT) \
+	CODEGEN_COMPOUND_LOOP_KERNEL(and_assign_loop_##SUFFIX, &, RAW, STRICT)
+
+#define CODEGEN_FLOAT_KERNELS(SUFFIX, RAW, STRICT)                        \
+	CODEGEN_SCALAR_KERNEL(add_##SUFFIX, +, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(sub_##SUFFIX, -, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(mul_##SUFFIX, *, RAW, STRICT)                    \
+	CODEGEN_SCALAR_KERNEL(div_##SUFFIX, /, RAW, STRICT)                    \
+	CODEGEN_LEFT_ONLY_KERNEL(mul_raw_##SUFFIX, *, RAW, STRICT)             \
+	CODEGEN_COMPARISON_KERNEL(eq_##SUFFIX, ==, RAW, STRICT)                \
+	CODEGEN_COMPARISON_KERNEL(lt_##SUFFIX, <, RAW, STRICT)                 \
+	CODEGEN_COMPARISON_KERNEL(ge_##SUFFIX, >=, RAW, STRICT)                \
+	CODEGEN_LOOP_KERNEL(add_loop_##SUFFIX, +, RAW, STRICT)                 \
+	CODEGEN_LOOP_KERNEL(mul_loop_##SUFFIX, *, RAW, STRICT)                 \
+	CODEGEN_COMPOUND_LOOP_KERNEL(add_assign_loop_##SUFFIX, +, RAW, STRICT)
+
+// Defines a kernel pair applying [OP] to one 16-byte pack, loaded from and stored to memory.
+// The raw kernel uses the vector extension type that strict_simd is expected to lower to.
+#define CODEGEN_SIMD_KERNEL(NAME, OP, RAW, STRICT)                                                     \
+	extern "C" void raw_##NAME(RAW* out, const RAW* left, const RAW* right) noexcept {                  \
+		typedef RAW pack __attribute__((vector_size(16)));                                               \
+		pack l, r;                                                                                       \
+		std::memcpy(&l, left, sizeof(pack));                                                             \
+		std::memcpy(&r, right, sizeof(pack));                                                            \
+		l = l OP r;                                                                                      \
+		std::memcpy(out, &l, sizeof(pack));                                                              \
+	}                                                                                                   \
+	extern "C" void strict_##NAME(STRICT* out, const STRICT* left, const STRICT* right) noexcept {      \
+		using pack = STRICT_TYPES_NAMESPACE::strict_simd<STRICT, 16 / sizeof(RAW)>;                      \
+		(pack::load({left, pack::width}) OP pack::load({right, pack::width})).store({out, pack::width}); \
+	}
+
+// Defines a kernel pair selecting the lane-wise minimum of two 16-byte packs through a comparison mask.
+#define CODEGEN_SIMD_MIN_KERNEL(NAME, RAW, STRICT)                                                \
+	extern "C" void raw_##NAME(RAW* out, const RAW* left, const RAW* right) noexcept {             \
+		typedef RAW pack __attribute__((vector_size(16)));                                          \
+		pack l, r;                                                                                  \
+		std::memcpy(&l, left, sizeof(pack));                                                        \
+		std::memcpy(&r, right, sizeof(pack));                                                       \
+		const auto mask = l < r;                                                                    \
+		l					 = mask ? l : r;                                                             \
+		std::memcpy(out, &l, sizeof(pack));                                                         \
+	}                                                                                              \
+	extern "C" void strict_##NAME(STRICT* out, const STRICT* left, const STRICT* right) noexcept { \
+		using pack	 = STRICT_TYPES_NAMESPACE::strict_simd<STRICT, 16 / sizeof(RAW)>;               \
+		const pack l = pack::load({left, pack::width});                                             \
+		const pack r = pack::load({right, pack::width});                                            \
+		STRICT_TYPES_NAMESPACE::select(l < r, l, r).store({out, pack::width});                      \
+	}
+
+CODEGEN_INTEGRAL_KERNELS(i8, std::int8_t, STRICT_TYPES_NAMESPACE::int8_t)
+CODEGEN_INTEGRAL_KERNELS(u16, std::uint16_t, STRICT_TYPES_NAMESPACE::uint16_t)
+CODEGEN_INTEGRAL_KERNELS(i32, std::int32_t, STRICT_TYPES_NAMESPACE::int32_t)
+CODEGEN_INTEGRAL_KERNELS(u64, std::uint64_t, STRICT_TYPES_NAMESPACE::uint64_t)
+
+CODEGEN_FLOAT_KERNELS(f32, float, STRICT_TYPES_NAMESPACE::float_t)
+CODEGEN_FLOAT_KERNELS(f64, double, STRICT_TYPES_NAMESPACE::double_t)
+
+CODEGEN_SIMD_KERNEL(simd_add_i32, +, std::int32_t, STRICT_TYPES_NAMESPACE::int32_t)
+CODEGEN_SIMD_KERNEL(simd_mul_u16, *, std::uint16_t, STRICT_TYPES_NAMESPACE::uint16_t)
+CODEGEN_SIMD_KERNEL(simd_xor_u64, ^, std::uint64_t, STRICT_TYPES_NAMESPACE::uint64_t)
+CODEGEN_SIMD_KERNEL(simd_shl_i8, <<, std::int8_t, STRICT_TYPES_NAMESPACE::int8_t)
+CODEGEN_SIMD_KERNEL(simd_add_f32, +, float, STRICT_TYPES_NAMESPACE::float_t)
+CODEGEN_SIMD_KERNEL(simd_div_f64, /, double, STRICT_TYPES_NAMESPACE::double_t)
+CODEGEN_SIMD_MIN_KERNEL(simd_min_i32, std::int32_t, STRICT_TYPES_NAMESPACE::int32_t)
+CODEGEN_SIMD_MIN_KERNEL(simd_min_f32, float, STRICT_TYPES_NAMESPACE::float_t)
@@ -0,0 +1,182 @@
+#include "benchmark.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Paired microbenchmarks of every operator generated by
+// STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS and STRICT_TYPES_DEFINE_COMPARISON_OPERATORS.
+// Each row runs the same element-wise kernel over raw built-ins and over the
+// equivalent strict type; a ratio close to 1.0 means the strict type is free.
+
+constexpr std::size_t element_count = 1 << 16;
+
+template <typename Type>
+std::vector<Type> make_operands(const bool non_zero) {
+	std::mt19937_64 engine(non_zero ? 1 : 2);
+
+	std::vector<Type> operands(element_count);
+
+	for (Type& operand : operands) {
+		if constexpr (std::is_floating_point_v<Type>) operand = static_cast<Type>(std::uniform_real_distribution<double>(1.0, 1000.0)(engine));
+		else if (non_zero) operand = static_cast<Type>(std::uniform_int_distribution<int>(1, 15)(engine));
+		else operand = static_cast<Type>(engine());
+	}
+
+	return operands;
+}
+
+template <typename Strict>
+std::vector<Strict> to_strict(const std::vector<typename Strict::type>& raw) {
+	std::vector<Strict> strict(raw.size());
+
+	for (std::size_t i = 0; i < raw.size(); ++i) strict[i] = raw[i];
+
+	return strict;
+}
+
+// Benchmarks [operation] as "raw OP raw", "strict OP strict", "strict OP raw" and "strict OP= strict".
+template <typename Strict, typename Operation, typename CompoundOperation>
+void benchmark_arithmetic(const std::string_view name, Operation operation, CompoundOperation compound_operation) {
+	using raw_t = typename Strict::type;
+
+	const std::vector<raw_t>  raw_lhs	  = make_operands<raw_t>(false);
+	const std::vector<raw_t>  raw_rhs	  = make_operands<raw_t>(true);
+	const std::vector<Strict> strict_lhs = to_strict<Strict>(raw_lhs);
+	const std::vector<Strict> strict_rhs = to_strict<Strict>(raw_rhs);
+
+	std::vector<raw_t>  raw_out(element_count);
+	std::vector<Strict> strict_out(element_count);
+
+	const double raw = benchmark::measure([&] {
+		for (std::size_t i = 0; i < element_count; ++i) raw_out[i] = static_cast<raw_t>(operation(raw_lhs[i], raw_rhs[i]));
+		benchmark::do_not_optimize(raw_out.data());
+	}, element_count);
+
+	const double strict = benchmark::measure([&] {
+		for (std::size_t i = 0; i < element_count; ++i) strict_out[i] = operation(strict_lhs[i], strict_rhs[i]);
+		benchmark::do_not_optimize(strict_out.data());
+	}, element_count);
+
+	const double strict_left_only = benchmark::measure([&] {
+		for (std::size_t i = 0; i < element_count; ++i) strict_out[i] = operation(strict_lhs[i], raw_rhs[i]);
+		benchmark::do_not_optimize(strict_out.data());
+	}, element_count);
+
+	const double raw_compound = benchmark::measure([&] {
+		for (std::size_t i = 0; i < element_count; ++i) {
+			raw_out[i] = raw_lhs[i];
+			compound_operation(raw_out[i], raw_rhs[i]);
+		}
+		benchmark::do_not_optimize(raw_out.data());
+	}, element_count);
+
+	const double strict_compound = benchmark::measure([&] {
+		for (std::size_t i = 0; i < element_count; ++i) {
+			strict_out[i] = strict_lhs[i];
+			compound_operation(strict_out[i], strict_rhs[i]);
+		}
+		benchmark::do_not_optimize(strict_out.data());
+	}, element_count);
+
+	benchmark::report(std::string(name), raw, strict);
+	benchmark::report(std::string(name) + " (raw rhs)", raw, strict_left_only);
+	benchmark::report(std::string(name) + "=", raw_compound, strict_compound);
+}
+
+// Benchmarks [operation] as "raw OP raw", "strict OP strict" and "strict OP raw", counting true results.
+template <typename Strict, typename Operation>
+void benchmark_comparison(const std::string_view name, Operation operation) {
+	using raw_t = typename Strict::type;
+
+	const std::vector<raw_t>  raw_lhs	  = make_operands<raw_t>(true);
+	const std::vector<raw_t>  raw_rhs	  = make_operands<raw_t>(true);
+	const std::vector<Strict> strict_lhs = to_strict<Strict>(raw_lhs);
+	const std::vector<Strict> strict_rhs = to_strict<Strict>(raw_rhs);
+
+	const double raw = benchmark::measure([&] {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < element_count; ++i) count += static_cast<std::size_t>(operation(raw_lhs[i], raw_rhs[i]));
+		benchmark::do_not_optimize(count);
+	}, element_count);
+
+	const double strict = benchmark::measure([&] {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < element_count; ++i) count += static_cast<std::size_t>(operation(strict_lhs[i], strict_rhs[i]));
+		benchmark::do_not_optimize(count);
+	}, element_count);
+
+	const double strict_left_only = benchmark::measure([&] {
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < element_count; ++i) count += static_cast<std::size_t>(operation(strict_lhs[i], raw_rhs[i]));
+		benchmark::do_not_optimize(count);
+	}, element_count);
+
+	benchmark::report(name, raw, strict);
+	benchmark::report(std::string(name) + " (raw rhs)", raw, strict_left_only);
+}
+
+#define BENCHMARK_ARITHMETIC(STRICT, OP)                               \
+	benchmark_arithmetic<STRICT>(                                       \
+		#OP,                                                             \
+		[](const auto left, const auto right) { return left OP right; }, \
+		[](auto& left, const auto right) { left OP## = right; }          \
+	)
+
+#define BENCHMARK_COMPARISON(STRICT, OP)                                                              \
+	benchmark_comparison<STRICT>(#OP, [](const auto left, const auto right) { return left OP right; })
+
+template <typename Strict>
+void benchmark_integral(const std::string_view title) {
+	benchmark::report_header(title);
+
+	BENCHMARK_ARITHMETIC(Strict, +);
+	BENCHMARK_ARITHMETIC(Strict, -);
+	BENCHMARK_ARITHMETIC(Strict, *);
+	BENCHMARK_ARITHMETIC(Strict, /);
+	BENCHMARK_ARITHMETIC(Strict, %);
+	BENCHMARK_ARITHMETIC(Strict, &);
+	BENCHMARK_ARITHMETIC(Strict, |);
+	BENCHMARK_ARITHMETIC(Strict, ^);
+	BENCHMARK_ARITHMETIC(Strict, <<);
+	BENCHMARK_ARITHMETIC(Strict, >>);
+
+	BENCHMARK_COMPARISON(Strict, ==);
+	BENCHMARK_COMPARISON(Strict, !=);
+	BENCHMARK_COMPARISON(Strict, >);
+	BENCHMARK_COMPARISON(Strict, <);
+	BENCHMARK_COMPARISON(Strict, >=);
+	BENCHMARK_COMPARISON(Strict, <=);
+}
+
+template <typename Strict>
+void benchmark_float(const std::string_view title) {
+	benchmark::report_header(title);
+
+	BENCHMARK_ARITHMETIC(Strict, +);
+	BENCHMARK_ARITHMETIC(Strict, -);
+	BENCHMARK_ARITHMETIC(Strict, *);
+	BENCHMARK_ARITHMETIC(Strict, /);
+
+	BENCHMARK_COMPARISON(Strict, ==);
+	BENCHMARK_COMPARISON(Strict, !=);
+	BENCHMARK_COMPARISON(Strict, >);
+	BENCHMARK_COMPARISON(Strict, <);
+	BENCHMARK_COMPARISON(Strict, >=);
+	BENCHMARK_COMPARISON(Strict, <=);
+}
+
+int main() {
+	benchmark_integral<STRICT_TYPES_NAMESPACE::int8_t>("std::int8_t vs strict::int8_t");
+	benchmark_integral<STRICT_TYPES_NAMESPACE::int32_t>("std::int32_t vs strict::int32_t");
+	benchmark_integral<STRICT_TYPES_NAMESPACE::uint64_t>("std::uint64_t vs strict::uint64_t");
+
+	benchmark_float<STRICT_TYPES_NAMESPACE::float_t>("float vs strict::float_t");
+	benchmark_float<STRICT_TYPES_NAMESPACE::double_t>("double vs strict::double_t");
+
+	return 0;
+}
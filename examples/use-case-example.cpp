@@ -168,6 +168,9 @@ int main() {
 	// Strict types can also be formatted:
 	output(std::format("I have a formatted number: {0}", STRICT_TYPES_NAMESPACE::int_t(-7)));
 
+	// Format-specs are forwarded to the encapsulated type's formatter:
+	output(std::format("I have a padded hex number: {0:#010x}, and a rounded number: {1:.2f}", STRICT_TYPES_NAMESPACE::uint_t(48879U), STRICT_TYPES_NAMESPACE::double_t(3.14159)));
+
 	// Custom types work the same as you'd expect:
 	customStrictTypeExample(5.0F); // Calls customStrictTypeExample() #1
 	customStrictTypeExample(1.6L); // Calls customStrictTypeExample() #1
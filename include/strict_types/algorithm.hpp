@@ -0,0 +1,101 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/macros.hpp"
+#include "strict_types/span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <type_traits>
+
+/*
+	algorithm.hpp description:
+		This header file contains fill, copy and zero helpers for contiguous ranges of
+		strict integral or strict float values, such as std::vector<strict::byte_t>.
+
+		The helpers work on the encapsulated values through as_raw_span(), and lower
+		straight to std::memset or std::memmove whenever the bytes allow it, rather than
+		relying on each toolchain to recognize an element-wise loop over a wrapper type.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		// Returns true if [Range] is a sized contiguous range of strict integral or strict float values.
+		template <typename Range>
+		concept is_strict_contiguous_range = std::ranges::contiguous_range<Range>
+													 && std::ranges::sized_range<Range>
+													 && STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<std::ranges::range_value_t<Range>>;
+
+		// Returns true if [Range] is a sized contiguous range of mutable strict integral or strict float values.
+		template <typename Range>
+		concept is_mutable_strict_contiguous_range = is_strict_contiguous_range<Range> && !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>;
+
+		/// @brief Returns true if every byte of [value] is the same, so a fill with it can be a memset.
+		///
+		//  Always false for long double, whose object representation contains padding bytes.
+		/// @returns bool
+		template <typename Type>
+		[[nodiscard]] inline constexpr bool has_uniform_bytes(const Type value) noexcept {
+			if constexpr (std::is_same_v<Type, long double>) return false;
+			else {
+				const auto bytes = std::bit_cast<std::array<unsigned char, sizeof(Type)>>(value);
+
+				return std::all_of(bytes.begin(), bytes.end(), [&](const unsigned char byte) { return byte == bytes[0]; });
+			}
+		}
+	}
+
+	/// @brief Sets every element of [values] to zero with a single memset.
+	///
+	//  An all-zero bit pattern is 0 for integral types and +0.0 for IEEE 754 floating-point types.
+	/// @tparam Range The contiguous range type, such as std::vector or std::span.
+	template <typename Range>
+		requires STRICT_TYPES_NAMESPACE::details::is_mutable_strict_contiguous_range<Range>
+	inline void zero(Range&& values) noexcept {
+		const auto raw = STRICT_TYPES_NAMESPACE::as_raw_span(values);
+
+		if (!raw.empty()) std::memset(raw.data(), 0, raw.size_bytes());
+	}
+
+	/// @brief Sets every element of [values] to [value].
+	///
+	//  Lowers to a memset when every byte of [value] is the same, which covers every
+	//  single-byte type, zero and all-ones. Otherwise fills the encapsulated values.
+	/// @tparam Range The contiguous range type, such as std::vector or std::span.
+	template <typename Range>
+		requires STRICT_TYPES_NAMESPACE::details::is_mutable_strict_contiguous_range<Range>
+	inline void fill(Range&& values, const std::ranges::range_value_t<Range> value) noexcept {
+		const auto raw = STRICT_TYPES_NAMESPACE::as_raw_span(values);
+
+		if (raw.empty()) return;
+
+		if (STRICT_TYPES_NAMESPACE::details::has_uniform_bytes(value.value)) {
+			std::memset(raw.data(), std::bit_cast<std::array<unsigned char, sizeof(value.value)>>(value.value)[0], raw.size_bytes());
+		}
+		else std::fill(raw.begin(), raw.end(), value.value);
+	}
+
+	/// @brief Copies every element of [source] to the beginning of [destination] with a single memmove.
+	///
+	//  Requirements:
+	//   - [destination] must hold at least as many elements as [source].
+	//   - The ranges may overlap.
+	/// @tparam Source The contiguous source range type.
+	/// @tparam Destination The contiguous destination range type.
+	template <typename Source, typename Destination>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_contiguous_range<Source>
+				&& STRICT_TYPES_NAMESPACE::details::is_mutable_strict_contiguous_range<Destination>
+				&& std::is_same_v<std::ranges::range_value_t<Source>, std::ranges::range_value_t<Destination>>
+	inline void copy(Source&& source, Destination&& destination) noexcept {
+		const auto raw_source		= STRICT_TYPES_NAMESPACE::as_raw_span(source);
+		const auto raw_destination = STRICT_TYPES_NAMESPACE::as_raw_span(destination);
+
+		STRICT_TYPES_ASSERT(raw_destination.size() >= raw_source.size(), "copy: the destination is smaller than the source");
+
+		if (!raw_source.empty()) std::memmove(raw_destination.data(), raw_source.data(), raw_source.size_bytes());
+	}
+}
@@ -1,14 +1,19 @@
 #pragma once
 
 #include "strict_types/concepts.hpp"
+#include "strict_types/fingerprint.hpp"
 
+#include <concepts>
+#include <cstddef>
 #include <format>
+#include <functional>
 #include <initializer_list>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 // TODO: add iostream support
-// TODO: add hash support
 
 /*
 	alias.hpp description:
@@ -27,6 +32,60 @@
 */
 
 namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The std::formatter a strict alias type's formatter inherits from.
+		///
+		//  Alias types with a formattable encapsulated type use its formatter, and every
+		//  other alias type is formatted as the string returned by to_string()/to_wstring().
+		/// @tparam Type The encapsulated type.
+		/// @tparam CharType The formatted character type.
+		template <typename Type, typename CharType>
+		using alias_formatter_t = std::conditional_t<
+			STRICT_TYPES_NAMESPACE::details::can_format<Type, CharType>,
+			std::formatter<Type, CharType>,
+			std::formatter<std::basic_string_view<CharType>, CharType>>;
+
+		/// @brief The element type of the encapsulated type, or void if it has none.
+		///
+		//  Used as the default argument type of forwarded functions, such as push_back(),
+		//  so braced initializers are converted to the element type.
+		/// @tparam Type The encapsulated type.
+		template <typename Type>
+		struct alias_value {
+				using type = void;
+		};
+
+		template <typename Type>
+			requires requires { typename Type::value_type; }
+		struct alias_value<Type> {
+				using type = typename Type::value_type;
+		};
+
+		template <typename Type>
+		using alias_value_t = typename alias_value<Type>::type;
+
+		/// @brief The std::hash a strict alias type's hash inherits from.
+		///
+		//  Disabled, like std::hash of the encapsulated type, when the encapsulated type is not hashable.
+		/// @tparam Alias The strict alias type.
+		template <typename Alias, bool = STRICT_TYPES_NAMESPACE::details::can_hash<typename Alias::type>>
+		struct alias_hash {
+				alias_hash()									  = delete;
+				alias_hash(const alias_hash&)				  = delete;
+				alias_hash& operator=(const alias_hash&) = delete;
+		};
+
+		/// @brief The std::hash a strict alias type's hash inherits from.
+		/// @tparam Alias The strict alias type.
+		template <typename Alias>
+		struct alias_hash<Alias, true> {
+				[[nodiscard]] inline std::size_t operator()(const Alias& alias) const
+					noexcept(noexcept(std::hash<typename Alias::type> {}(alias.value))) {
+					return std::hash<typename Alias::type> {}(alias.value);
+				}
+		};
+	}
+
 	/// @brief Strictly-typed alias encapsulation struct.
 	///
 	//  Requirements:
@@ -65,14 +124,32 @@ namespace STRICT_TYPES_NAMESPACE {
 				value(initializer_list) { }
 
 			/// @brief Move-assignment operator.
+			/// @returns strict_alias_type&
+			inline constexpr strict_alias_type& operator=(strict_alias_type&& other) noexcept(std::is_nothrow_move_assignable_v<Type>) {
+				this->value = std::move(other.value);
+
+				return *this;
+			}
+
+			/// @brief Copy-assignment operator.
+			/// @returns strict_alias_type&
+			inline constexpr strict_alias_type& operator=(const strict_alias_type& other) noexcept(std::is_nothrow_copy_assignable_v<Type>)
+				requires std::is_copy_assignable_v<Type>
+			{
+				this->value = other.value;
+
+				return *this;
+			}
+
+			/// @brief Forwarding assignment operator, moving from rvalues and copying from lvalues.
 			/// @tparam Other The assignment type.
-			/// @param other The move-assignment value.
+			/// @param other The assignment value.
 			/// @returns auto&
 			template <typename Other>
 				requires std::is_convertible_v<Other, Type>
-			inline constexpr auto& operator=(Other&& other) noexcept(std::is_nothrow_move_assignable_v<Type>) {
-				if constexpr (std::is_base_of_v<Other, STRICT_TYPES_NAMESPACE::details::strict_types_alias_base_t>) this->value = std::move(other.value);
-				else this->value = std::move(other);
+			inline constexpr auto& operator=(Other&& other) noexcept(std::is_nothrow_assignable_v<Type&, Other>) {
+				if constexpr (std::is_base_of_v<STRICT_TYPES_NAMESPACE::details::strict_types_alias_base_t, std::remove_cvref_t<Other>>) this->value = std::forward<Other>(other).value;
+				else this->value = std::forward<Other>(other);
 
 				return *this;
 			}
@@ -84,7 +161,7 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires std::is_convertible_v<Other, Type>
 			inline constexpr auto& operator=(const Other& other) noexcept(std::is_nothrow_copy_assignable_v<Type>) {
-				if constexpr (std::is_base_of_v<Other, STRICT_TYPES_NAMESPACE::details::strict_types_alias_base_t>) this->value = other.value;
+				if constexpr (std::is_base_of_v<STRICT_TYPES_NAMESPACE::details::strict_types_alias_base_t, Other>) this->value = other.value;
 				else this->value = other;
 
 				return *this;
@@ -153,28 +230,28 @@ namespace STRICT_TYPES_NAMESPACE {
 			inline constexpr const Type* operator->() const noexcept { return std::addressof(this->value); }
 
 			/// @brief rvalue subscript operator.
-			/// @returns auto&
+			/// @returns decltype(auto)
 			template <typename IndexType>
 				requires STRICT_TYPES_NAMESPACE::details::has_subscript_operator<Type, IndexType>
-			inline constexpr auto& operator[](IndexType&& index) noexcept { return this->value[std::forward<IndexType>(index)]; }
+			inline constexpr decltype(auto) operator[](IndexType&& index) noexcept(noexcept(this->value[std::forward<IndexType>(index)])) { return this->value[std::forward<IndexType>(index)]; }
 
 			/// @brief Const rvalue subscript operator.
-			/// @returns const auto&
+			/// @returns decltype(auto)
 			template <typename IndexType>
 				requires STRICT_TYPES_NAMESPACE::details::has_subscript_operator<Type, IndexType>
-			inline constexpr const auto& operator[](IndexType&& index) const noexcept { return this->value[std::forward<IndexType>(index)]; }
+			inline constexpr decltype(auto) operator[](IndexType&& index) const noexcept(noexcept(this->value[std::forward<IndexType>(index)])) { return this->value[std::forward<IndexType>(index)]; }
 
 			/// @brief lvalue subscript operator.
-			/// @returns auto&
+			/// @returns decltype(auto)
 			template <typename IndexType>
 				requires STRICT_TYPES_NAMESPACE::details::has_subscript_operator<Type, IndexType>
-			inline constexpr auto& operator[](const IndexType& index) noexcept { return this->value[index]; }
+			inline constexpr decltype(auto) operator[](const IndexType& index) noexcept(noexcept(this->value[index])) { return this->value[index]; }
 
 			/// @brief Const lvalue subscript operator.
-			/// @returns const auto&
+			/// @returns decltype(auto)
 			template <typename IndexType>
 				requires STRICT_TYPES_NAMESPACE::details::has_subscript_operator<Type, IndexType>
-			inline constexpr const auto& operator[](const IndexType& index) const noexcept { return this->value[index]; }
+			inline constexpr decltype(auto) operator[](const IndexType& index) const noexcept(noexcept(this->value[index])) { return this->value[index]; }
 
 			/// @brief Conversion function.
 			/// @tparam Other The type to convert to.
@@ -198,111 +275,230 @@ namespace STRICT_TYPES_NAMESPACE {
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_data_function<Type>
-			inline constexpr auto data() noexcept { return this->value.data(); }
+			inline constexpr decltype(auto) data() noexcept(noexcept(this->value.data())) { return this->value.data(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_data_function<Type>
-			inline constexpr auto data() const noexcept { return this->value.data(); }
+			inline constexpr decltype(auto) data() const noexcept(noexcept(this->value.data())) { return this->value.data(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_begin_function<Type>
-			inline constexpr auto begin() noexcept { return this->value.begin(); }
+			inline constexpr decltype(auto) begin() noexcept(noexcept(this->value.begin())) { return this->value.begin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_begin_function<Type>
-			inline constexpr auto begin() const noexcept { return this->value.begin(); }
+			inline constexpr decltype(auto) begin() const noexcept(noexcept(this->value.begin())) { return this->value.begin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_end_function<Type>
-			inline constexpr auto end() noexcept { return this->value.end(); }
+			inline constexpr decltype(auto) end() noexcept(noexcept(this->value.end())) { return this->value.end(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_end_function<Type>
-			inline constexpr auto end() const noexcept { return this->value.end(); }
+			inline constexpr decltype(auto) end() const noexcept(noexcept(this->value.end())) { return this->value.end(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_rbegin_function<Type>
-			inline constexpr auto rbegin() noexcept { return this->value.rbegin(); }
+			inline constexpr decltype(auto) rbegin() noexcept(noexcept(this->value.rbegin())) { return this->value.rbegin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_rbegin_function<Type>
-			inline constexpr auto rbegin() const noexcept { return this->value.rbegin(); }
+			inline constexpr decltype(auto) rbegin() const noexcept(noexcept(this->value.rbegin())) { return this->value.rbegin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_rend_function<Type>
-			inline constexpr auto rend() noexcept { return this->value.rend(); }
+			inline constexpr decltype(auto) rend() noexcept(noexcept(this->value.rend())) { return this->value.rend(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_rend_function<Type>
-			inline constexpr auto rend() const noexcept { return this->value.rend(); }
+			inline constexpr decltype(auto) rend() const noexcept(noexcept(this->value.rend())) { return this->value.rend(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_cbegin_function<Type>
-			inline constexpr auto cbegin() const noexcept { return this->value.cbegin(); }
+			inline constexpr decltype(auto) cbegin() const noexcept(noexcept(this->value.cbegin())) { return this->value.cbegin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_cend_function<Type>
-			inline constexpr auto cend() const noexcept { return this->value.cend(); }
+			inline constexpr decltype(auto) cend() const noexcept(noexcept(this->value.cend())) { return this->value.cend(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_crbegin_function<Type>
-			inline constexpr auto crbegin() const noexcept { return this->value.crbegin(); }
+			inline constexpr decltype(auto) crbegin() const noexcept(noexcept(this->value.crbegin())) { return this->value.crbegin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_crend_function<Type>
-			inline constexpr auto crend() const noexcept { return this->value.crend(); }
+			inline constexpr decltype(auto) crend() const noexcept(noexcept(this->value.crend())) { return this->value.crend(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_Unchecked_begin_function<Type>
-			inline constexpr auto _Unchecked_begin() noexcept { return this->value._Unchecked_begin(); }
+			inline constexpr decltype(auto) _Unchecked_begin() noexcept(noexcept(this->value._Unchecked_begin())) { return this->value._Unchecked_begin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_Unchecked_begin_function<Type>
-			inline constexpr auto _Unchecked_begin() const noexcept { return this->value._Unchecked_begin(); }
+			inline constexpr decltype(auto) _Unchecked_begin() const noexcept(noexcept(this->value._Unchecked_begin())) { return this->value._Unchecked_begin(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_Unchecked_end_function<Type>
-			inline constexpr auto _Unchecked_end() noexcept { return this->value._Unchecked_end(); }
+			inline constexpr decltype(auto) _Unchecked_end() noexcept(noexcept(this->value._Unchecked_end())) { return this->value._Unchecked_end(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_Unchecked_end_function<Type>
-			inline constexpr auto _Unchecked_end() const noexcept { return this->value._Unchecked_end(); }
+			inline constexpr decltype(auto) _Unchecked_end() const noexcept(noexcept(this->value._Unchecked_end())) { return this->value._Unchecked_end(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_empty_function<Type>
-			inline constexpr auto empty() const noexcept { return this->value.empty(); }
+			inline constexpr decltype(auto) empty() const noexcept(noexcept(this->value.empty())) { return this->value.empty(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_size_function<Type>
-			inline constexpr auto size() const noexcept { return this->value.size(); }
+			inline constexpr decltype(auto) size() const noexcept(noexcept(this->value.size())) { return this->value.size(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_max_size_function<Type>
-			inline constexpr auto max_size() const noexcept { return this->value.max_size(); }
+			inline constexpr decltype(auto) max_size() const noexcept(noexcept(this->value.max_size())) { return this->value.max_size(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_capacity_function<Type>
-			inline constexpr auto capacity() const noexcept { return this->value.capacity(); }
+			inline constexpr decltype(auto) capacity() const noexcept(noexcept(this->value.capacity())) { return this->value.capacity(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_front_function<Type>
-			inline constexpr auto front() noexcept { return this->value.front(); }
+			inline constexpr decltype(auto) front() noexcept(noexcept(this->value.front())) { return this->value.front(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_front_function<Type>
-			inline constexpr auto front() const noexcept { return this->value.front(); }
+			inline constexpr decltype(auto) front() const noexcept(noexcept(this->value.front())) { return this->value.front(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_back_function<Type>
-			inline constexpr auto back() noexcept { return this->value.back(); }
+			inline constexpr decltype(auto) back() noexcept(noexcept(this->value.back())) { return this->value.back(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_back_function<Type>
-			inline constexpr auto back() const noexcept { return this->value.back(); }
+			inline constexpr decltype(auto) back() const noexcept(noexcept(this->value.back())) { return this->value.back(); }
 
 			template <typename _ = void>
 				requires STRICT_TYPES_NAMESPACE::details::has_get_allocator_function<Type>
-			inline constexpr auto get_allocator() const noexcept { return this->value.get_allocator(); }
+			inline constexpr decltype(auto) get_allocator() const noexcept(noexcept(this->value.get_allocator())) { return this->value.get_allocator(); }
+
+			// Mutating container functions, forwarded with their arguments so values can be
+			// constructed in place, such as by emplace_back(), without a temporary.
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_reserve_function<Type, Args...>
+			inline constexpr decltype(auto) reserve(Args&&... args) noexcept(noexcept(this->value.reserve(std::forward<Args>(args)...))) {
+				return this->value.reserve(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_resize_function<Type, Args...>
+			inline constexpr decltype(auto) resize(Args&&... args) noexcept(noexcept(this->value.resize(std::forward<Args>(args)...))) {
+				return this->value.resize(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_shrink_to_fit_function<Type, Args...>
+			inline constexpr decltype(auto) shrink_to_fit(Args&&... args) noexcept(noexcept(this->value.shrink_to_fit(std::forward<Args>(args)...))) {
+				return this->value.shrink_to_fit(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_clear_function<Type, Args...>
+			inline constexpr decltype(auto) clear(Args&&... args) noexcept(noexcept(this->value.clear(std::forward<Args>(args)...))) {
+				return this->value.clear(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_assign_function<Type, Args...>
+			inline constexpr decltype(auto) assign(Args&&... args) noexcept(noexcept(this->value.assign(std::forward<Args>(args)...))) {
+				return this->value.assign(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_append_function<Type, Args...>
+			inline constexpr decltype(auto) append(Args&&... args) noexcept(noexcept(this->value.append(std::forward<Args>(args)...))) {
+				return this->value.append(std::forward<Args>(args)...);
+			}
+
+			// [Value] defaults to the element type, so braced initializers such as push_back({a, b}) also compile.
+			template <typename Value = STRICT_TYPES_NAMESPACE::details::alias_value_t<Type>>
+				requires STRICT_TYPES_NAMESPACE::details::has_push_back_function<Type, Value>
+			inline constexpr decltype(auto) push_back(Value&& value) noexcept(noexcept(this->value.push_back(std::forward<Value>(value)))) {
+				return this->value.push_back(std::forward<Value>(value));
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_emplace_back_function<Type, Args...>
+			inline constexpr decltype(auto) emplace_back(Args&&... args) noexcept(noexcept(this->value.emplace_back(std::forward<Args>(args)...))) {
+				return this->value.emplace_back(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_pop_back_function<Type, Args...>
+			inline constexpr decltype(auto) pop_back(Args&&... args) noexcept(noexcept(this->value.pop_back(std::forward<Args>(args)...))) {
+				return this->value.pop_back(std::forward<Args>(args)...);
+			}
+
+			// [Value] defaults to the element type, so braced initializers such as push_front({a, b}) also compile.
+			template <typename Value = STRICT_TYPES_NAMESPACE::details::alias_value_t<Type>>
+				requires STRICT_TYPES_NAMESPACE::details::has_push_front_function<Type, Value>
+			inline constexpr decltype(auto) push_front(Value&& value) noexcept(noexcept(this->value.push_front(std::forward<Value>(value)))) {
+				return this->value.push_front(std::forward<Value>(value));
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_emplace_front_function<Type, Args...>
+			inline constexpr decltype(auto) emplace_front(Args&&... args) noexcept(noexcept(this->value.emplace_front(std::forward<Args>(args)...))) {
+				return this->value.emplace_front(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_pop_front_function<Type, Args...>
+			inline constexpr decltype(auto) pop_front(Args&&... args) noexcept(noexcept(this->value.pop_front(std::forward<Args>(args)...))) {
+				return this->value.pop_front(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_insert_function<Type, Args...>
+			inline constexpr decltype(auto) insert(Args&&... args) noexcept(noexcept(this->value.insert(std::forward<Args>(args)...))) {
+				return this->value.insert(std::forward<Args>(args)...);
+			}
+
+			template <typename Value = STRICT_TYPES_NAMESPACE::details::alias_value_t<Type>>
+				requires STRICT_TYPES_NAMESPACE::details::has_insert_function<Type, Value>
+			inline constexpr decltype(auto) insert(Value&& value) noexcept(noexcept(this->value.insert(std::forward<Value>(value)))) {
+				return this->value.insert(std::forward<Value>(value));
+			}
+
+			template <typename Position, typename Value = STRICT_TYPES_NAMESPACE::details::alias_value_t<Type>>
+				requires STRICT_TYPES_NAMESPACE::details::has_insert_function<Type, Position, Value>
+			inline constexpr decltype(auto) insert(Position&& position, Value&& value) noexcept(noexcept(this->value.insert(std::forward<Position>(position), std::forward<Value>(value)))) {
+				return this->value.insert(std::forward<Position>(position), std::forward<Value>(value));
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_emplace_function<Type, Args...>
+			inline constexpr decltype(auto) emplace(Args&&... args) noexcept(noexcept(this->value.emplace(std::forward<Args>(args)...))) {
+				return this->value.emplace(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_emplace_hint_function<Type, Args...>
+			inline constexpr decltype(auto) emplace_hint(Args&&... args) noexcept(noexcept(this->value.emplace_hint(std::forward<Args>(args)...))) {
+				return this->value.emplace_hint(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_try_emplace_function<Type, Args...>
+			inline constexpr decltype(auto) try_emplace(Args&&... args) noexcept(noexcept(this->value.try_emplace(std::forward<Args>(args)...))) {
+				return this->value.try_emplace(std::forward<Args>(args)...);
+			}
+
+			template <typename... Args>
+				requires STRICT_TYPES_NAMESPACE::details::has_erase_function<Type, Args...>
+			inline constexpr decltype(auto) erase(Args&&... args) noexcept(noexcept(this->value.erase(std::forward<Args>(args)...))) {
+				return this->value.erase(std::forward<Args>(args)...);
+			}
 
 		protected:
 			template <typename _ = void>
@@ -337,91 +533,118 @@ namespace STRICT_TYPES_NAMESPACE {
 //
 // Usage example:
 //    STRICT_TYPES_DEFINE_ALIAS_TYPE(my_vector_t, std::vector<int>)
-#define STRICT_TYPES_DEFINE_ALIAS_TYPE(NAME, TYPE)                                                                                                                                         \
-	namespace STRICT_TYPES_NAMESPACE {                                                                                                                                                      \
-		struct NAME : STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE> {                                                                                                                      \
-				using Type = TYPE;                                                                                                                                                             \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::strict_alias_type;                                                                                                      \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator=;                                                                                                              \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator->;                                                                                                             \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator[];                                                                                                             \
-                                                                                                                                                                                           \
-				template <typename _ = void>                                                                                                                                                   \
-					requires STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE>                                                                                                               \
-				inline std::string to_string() const noexcept {                                                                                                                                \
-					return this->m_get_string_internal();                                                                                                                                       \
-				}                                                                                                                                                                              \
-                                                                                                                                                                                           \
-				template <typename _ = void>                                                                                                                                                   \
-					requires STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE>                                                                                                              \
-				inline std::wstring to_wstring() const noexcept {                                                                                                                              \
-					return this->m_get_wstring_internal();                                                                                                                                      \
-				}                                                                                                                                                                              \
-                                                                                                                                                                                           \
-				template <typename _ = void>                                                                                                                                                   \
-					requires (!STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE>)                                                                                                            \
-				inline std::string to_string() const noexcept {                                                                                                                                \
-					return "strict::" #NAME;                                                                                                                                                    \
-				}                                                                                                                                                                              \
-                                                                                                                                                                                           \
-				template <typename _ = void>                                                                                                                                                   \
-					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE>)                                                                                                           \
-				inline std::wstring to_wstring() const noexcept {                                                                                                                              \
-					return L"strict::" L#NAME;                                                                                                                                                  \
-				}                                                                                                                                                                              \
-		};                                                                                                                                                                                   \
-	}                                                                                                                                                                                       \
-	template <>                                                                                                                                                                             \
-	struct _STD formatter<STRICT_TYPES_NAMESPACE::NAME> {                                                                                                                                   \
-			inline constexpr auto parse(const _STD format_parse_context& context) const noexcept { return context.begin(); }                                                                  \
-			inline constexpr auto parse(const _STD wformat_parse_context& context) const noexcept { return context.begin(); }                                                                 \
-			inline auto				 format(const STRICT_TYPES_NAMESPACE::NAME& value, _STD format_context& context) const { return _STD format_to(context.out(), "{}", value.to_string()); }    \
-			inline auto				 format(const STRICT_TYPES_NAMESPACE::NAME& value, _STD wformat_context& context) const { return _STD format_to(context.out(), L"{}", value.to_wstring()); } \
-	};
+#define STRICT_TYPES_DEFINE_ALIAS_TYPE(NAME, TYPE)                                                                                                                      \
+	namespace STRICT_TYPES_NAMESPACE {                                                                                                                                   \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE> {                                                                                                   \
+				using Type = TYPE;                                                                                                                                          \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::strict_alias_type;                                                                                   \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator=;                                                                                           \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator->;                                                                                          \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE>::operator[];                                                                                          \
+                                                                                                                                                                        \
+				template <typename Other = NAME>                                                                                                                            \
+					requires std::is_same_v<Other, NAME> && std::equality_comparable<TYPE>                                                                                   \
+				[[nodiscard]] inline constexpr bool operator==(const Other& other) const noexcept(std::is_nothrow_invocable_v<std::equal_to<>, const TYPE&, const TYPE&>) { \
+					return this->value == other.value;                                                                                                                       \
+				}                                                                                                                                                           \
+                                                                                                                                                                        \
+				template <typename _ = void>                                                                                                                                \
+					requires STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE>                                                                                            \
+				inline std::string to_string() const noexcept {                                                                                                             \
+					return this->m_get_string_internal();                                                                                                                    \
+				}                                                                                                                                                           \
+                                                                                                                                                                        \
+				template <typename _ = void>                                                                                                                                \
+					requires STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE>                                                                                           \
+				inline std::wstring to_wstring() const noexcept {                                                                                                           \
+					return this->m_get_wstring_internal();                                                                                                                   \
+				}                                                                                                                                                           \
+                                                                                                                                                                        \
+				template <typename _ = void>                                                                                                                                \
+					requires (!STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE>)                                                                                         \
+				inline std::string to_string() const noexcept {                                                                                                             \
+					return "strict::" #NAME;                                                                                                                                 \
+				}                                                                                                                                                           \
+                                                                                                                                                                        \
+				template <typename _ = void>                                                                                                                                \
+					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE>)                                                                                        \
+				inline std::wstring to_wstring() const noexcept {                                                                                                           \
+					return L"strict::" #NAME;                                                                                                                                \
+				}                                                                                                                                                           \
+		};                                                                                                                                                                \
+	}                                                                                                                                                                    \
+	template <typename CharType>                                                                                                                                         \
+	struct std::formatter<STRICT_TYPES_NAMESPACE::NAME, CharType> : STRICT_TYPES_NAMESPACE::details::alias_formatter_t<TYPE, CharType> {                                 \
+			template <typename FormatContext>                                                                                                                              \
+			inline auto format(const STRICT_TYPES_NAMESPACE::NAME& value, FormatContext& context) const {                                                                  \
+				using base_formatter = STRICT_TYPES_NAMESPACE::details::alias_formatter_t<TYPE, CharType>;                                                                  \
+                                                                                                                                                                        \
+				if constexpr (STRICT_TYPES_NAMESPACE::details::can_format<TYPE, CharType>) return base_formatter::format(value.value, context);                             \
+				else if constexpr (std::is_same_v<CharType, wchar_t>) return base_formatter::format(value.to_wstring(), context);                                           \
+				else return base_formatter::format(value.to_string(), context);                                                                                             \
+			}                                                                                                                                                              \
+	};                                                                                                                                                                   \
+	template <>                                                                                                                                                          \
+	struct std::hash<STRICT_TYPES_NAMESPACE::NAME> : STRICT_TYPES_NAMESPACE::details::alias_hash<STRICT_TYPES_NAMESPACE::NAME> { };                                      \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME)
 
 // Defines a strict dynamic alias type.
 //
 // Usage example:
 //    STRICT_TYPES_DEFINE_DYNAMIC_ALIAS_TYPE(my_dynamic_vector, std::vector)
-#define STRICT_TYPES_DEFINE_DYNAMIC_ALIAS_TYPE(NAME, TYPE)                                                                                                                                          \
-	namespace STRICT_TYPES_NAMESPACE {                                                                                                                                                               \
-		template <typename... Args>                                                                                                                                                                   \
-		struct NAME : STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>> {                                                                                                                      \
-				using Type = TYPE<Args...>;                                                                                                                                                             \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::strict_alias_type;                                                                                                      \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator=;                                                                                                              \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator->;                                                                                                             \
-				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator[];                                                                                                             \
-                                                                                                                                                                                                    \
-				template <typename _ = void>                                                                                                                                                            \
-					requires STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE<Args...>>                                                                                                               \
-				inline std::string to_string() const noexcept {                                                                                                                                         \
-					return this->m_get_string_internal();                                                                                                                                                \
-				}                                                                                                                                                                                       \
-                                                                                                                                                                                                    \
-				template <typename _ = void>                                                                                                                                                            \
-					requires STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>                                                                                                              \
-				inline std::wstring to_wstring() const noexcept {                                                                                                                                       \
-					return this->m_get_wstring_internal();                                                                                                                                               \
-				}                                                                                                                                                                                       \
-                                                                                                                                                                                                    \
-				template <typename _ = void>                                                                                                                                                            \
-					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>)                                                                                                           \
-				inline std::string to_string() const noexcept {                                                                                                                                         \
-					return "strict::" #NAME "<" #TYPE "<...>>";                                                                                                                                          \
-				}                                                                                                                                                                                       \
-                                                                                                                                                                                                    \
-				template <typename _ = void>                                                                                                                                                            \
-					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>)                                                                                                           \
-				inline std::wstring to_wstring() const noexcept {                                                                                                                                       \
-					return L"strict::" L#NAME L"<" L#TYPE L"<...>>";                                                                                                                                     \
-				}                                                                                                                                                                                       \
-		};                                                                                                                                                                                            \
-	}                                                                                                                                                                                                \
-	template <typename... Args>                                                                                                                                                                      \
-	struct _STD formatter<STRICT_TYPES_NAMESPACE::NAME<Args...>> {                                                                                                                                   \
-			inline constexpr auto parse(const _STD format_parse_context& context) const noexcept { return context.begin(); }                                                                           \
-			inline constexpr auto parse(const _STD wformat_parse_context& context) const noexcept { return context.begin(); }                                                                          \
-			inline auto				 format(const STRICT_TYPES_NAMESPACE::NAME<Args...>& value, _STD format_context& context) const { return _STD format_to(context.out(), "{}", value.to_string()); }    \
-			inline auto				 format(const STRICT_TYPES_NAMESPACE::NAME<Args...>& value, _STD wformat_context& context) const { return _STD format_to(context.out(), L"{}", value.to_wstring()); } \
-	};
+#define STRICT_TYPES_DEFINE_DYNAMIC_ALIAS_TYPE(NAME, TYPE)                                                                                                                                \
+	namespace STRICT_TYPES_NAMESPACE {                                                                                                                                                     \
+		template <typename... Args>                                                                                                                                                         \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>> {                                                                                                            \
+				using Type = TYPE<Args...>;                                                                                                                                                   \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::strict_alias_type;                                                                                            \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator=;                                                                                                    \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator->;                                                                                                   \
+				using STRICT_TYPES_NAMESPACE::strict_alias_type<TYPE<Args...>>::operator[];                                                                                                   \
+                                                                                                                                                                                          \
+				template <typename Other = NAME>                                                                                                                                              \
+					requires std::is_same_v<Other, NAME> && std::equality_comparable<TYPE<Args...>>                                                                                            \
+				[[nodiscard]] inline constexpr bool operator==(const Other& other) const noexcept(std::is_nothrow_invocable_v<std::equal_to<>, const TYPE<Args...>&, const TYPE<Args...>&>) { \
+					return this->value == other.value;                                                                                                                                         \
+				}                                                                                                                                                                             \
+                                                                                                                                                                                          \
+				template <typename _ = void>                                                                                                                                                  \
+					requires STRICT_TYPES_NAMESPACE::details::can_stringify<TYPE<Args...>>                                                                                                     \
+				inline std::string to_string() const noexcept {                                                                                                                               \
+					return this->m_get_string_internal();                                                                                                                                      \
+				}                                                                                                                                                                             \
+                                                                                                                                                                                          \
+				template <typename _ = void>                                                                                                                                                  \
+					requires STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>                                                                                                    \
+				inline std::wstring to_wstring() const noexcept {                                                                                                                             \
+					return this->m_get_wstring_internal();                                                                                                                                     \
+				}                                                                                                                                                                             \
+                                                                                                                                                                                          \
+				template <typename _ = void>                                                                                                                                                  \
+					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>)                                                                                                 \
+				inline std::string to_string() const noexcept {                                                                                                                               \
+					return "strict::" #NAME "<" #TYPE "<...>>";                                                                                                                                \
+				}                                                                                                                                                                             \
+                                                                                                                                                                                          \
+				template <typename _ = void>                                                                                                                                                  \
+					requires (!STRICT_TYPES_NAMESPACE::details::can_wstringify<TYPE<Args...>>)                                                                                                 \
+				inline std::wstring to_wstring() const noexcept {                                                                                                                             \
+					return L"strict::" #NAME L"<" #TYPE L"<...>>";                                                                                                                             \
+				}                                                                                                                                                                             \
+		};                                                                                                                                                                                  \
+	}                                                                                                                                                                                      \
+	template <typename CharType, typename... Args>                                                                                                                                         \
+	struct std::formatter<STRICT_TYPES_NAMESPACE::NAME<Args...>, CharType> : STRICT_TYPES_NAMESPACE::details::alias_formatter_t<TYPE<Args...>, CharType> {                                 \
+			template <typename FormatContext>                                                                                                                                                \
+			inline auto format(const STRICT_TYPES_NAMESPACE::NAME<Args...>& value, FormatContext& context) const {                                                                           \
+				using base_formatter = STRICT_TYPES_NAMESPACE::details::alias_formatter_t<TYPE<Args...>, CharType>;                                                                           \
+                                                                                                                                                                                          \
+				if constexpr (STRICT_TYPES_NAMESPACE::details::can_format<TYPE<Args...>, CharType>) return base_formatter::format(value.value, context);                                      \
+				else if constexpr (std::is_same_v<CharType, wchar_t>) return base_formatter::format(value.to_wstring(), context);                                                             \
+				else return base_formatter::format(value.to_string(), context);                                                                                                               \
+			}                                                                                                                                                                                \
+	};                                                                                                                                                                                     \
+	template <typename... Args>                                                                                                                                                            \
+	struct std::hash<STRICT_TYPES_NAMESPACE::NAME<Args...>> : STRICT_TYPES_NAMESPACE::details::alias_hash<STRICT_TYPES_NAMESPACE::NAME<Args...>> { };                                      \
+	template <typename... Args>                                                                                                                                                            \
+	struct STRICT_TYPES_NAMESPACE::layout_fingerprint<STRICT_TYPES_NAMESPACE::NAME<Args...>> : std::integral_constant<std::uint64_t, STRICT_TYPES_NAMESPACE::details::strict_layout_fingerprint<STRICT_TYPES_NAMESPACE::NAME<Args...>>(#NAME)> { };
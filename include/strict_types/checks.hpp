@@ -0,0 +1,92 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/macros.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	checks.hpp description:
+		This header file contains the predicates asserted by STRICT_TYPES_ASSERT_CHECKED
+		at the checked strictness level: range checks for narrowing conversions, and
+		operand checks for integral division and shifts.
+
+		Below the checked level STRICT_TYPES_ASSERT_CHECKED discards its condition, so
+		none of these functions are called and the generated code is unchanged.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief Returns true if [value] is representable by [To], so converting it with static_cast is exact or well-defined.
+		///
+		//  Integral targets must hold the (truncated) value, and floating-point targets must
+		//  hold the finite value within their range. Conversions between other types, and
+		//  to bool, are always in range.
+		/// @tparam To The type to convert to.
+		/// @returns bool
+		template <typename To, typename From>
+		[[nodiscard]] inline constexpr bool is_in_range(const From& value) noexcept {
+			if constexpr (STRICT_TYPES_NAMESPACE::details::is_strict_type<From>) return is_in_range<To>(static_cast<typename From::type>(value.value));
+			else if constexpr (STRICT_TYPES_NAMESPACE::details::is_strict_type<To>) return is_in_range<typename To::type>(value);
+			else if constexpr (!std::is_arithmetic_v<From> || !std::is_arithmetic_v<To> || std::is_same_v<To, bool> || std::is_same_v<From, bool>) return true;
+			else if constexpr (std::is_integral_v<To> && std::is_integral_v<From>) {
+				// Spelled out instead of std::in_range, which rejects character types.
+				if constexpr (std::is_signed_v<From> == std::is_signed_v<To>) return value >= std::numeric_limits<To>::min() && value <= std::numeric_limits<To>::max();
+				else if constexpr (std::is_signed_v<From>) return value >= 0 && static_cast<std::make_unsigned_t<From>>(value) <= std::numeric_limits<To>::max();
+				else return value <= static_cast<std::make_unsigned_t<To>>(std::numeric_limits<To>::max());
+			}
+			else if constexpr (std::is_integral_v<To>) {
+				// Both bounds are powers of two, so they are exact in [From].
+				constexpr From lower = static_cast<From>(std::numeric_limits<To>::min());
+				constexpr From upper = static_cast<From>(std::numeric_limits<To>::max() / 2 + 1) * From {2};
+
+				return (value > lower - From {1} || value == lower) && value < upper;
+			}
+			else if constexpr (std::is_floating_point_v<From> && std::numeric_limits<From>::max() > std::numeric_limits<To>::max()) {
+				return value != value || (value >= std::numeric_limits<To>::lowest() && value <= std::numeric_limits<To>::max())
+					 || value == std::numeric_limits<From>::infinity() || value == -std::numeric_limits<From>::infinity();
+			}
+			else return true;
+		}
+
+		/// @brief Returns true if [right] is a valid right operand of the integral [operation] with [left].
+		///
+		//  Division and remainder require a non-zero divisor, and shifts require a width
+		//  below the bit width of the promoted left operand. Every other operation, and
+		//  every operation on non-integral operands, is valid. Operands stored through a
+		//  proxy with a native_type, such as the value of strict::big_endian, are checked
+		//  as the native value they hold.
+		/// @param operation The operator, such as "/" or "<<".
+		/// @returns bool
+		template <typename Left, typename Right>
+		[[nodiscard]] inline constexpr bool are_valid_operands([[maybe_unused]] const std::string_view operation, [[maybe_unused]] const Left& left, [[maybe_unused]] const Right& right) noexcept {
+			if constexpr (requires { typename Left::native_type; }) return are_valid_operands(operation, static_cast<typename Left::native_type>(left), right);
+			else if constexpr (requires { typename Right::native_type; }) return are_valid_operands(operation, left, static_cast<typename Right::native_type>(right));
+			else if constexpr (std::is_integral_v<Left> && std::is_integral_v<Right>) {
+				if (operation == "/" || operation == "%") return right != 0;
+				if (operation == "<<" || operation == ">>") {
+					if constexpr (std::is_signed_v<Right>) {
+						if (right < 0) return false;
+					}
+
+					return static_cast<std::uintmax_t>(right) < sizeof(+left) * CHAR_BIT;
+				}
+			}
+
+			return true;
+		}
+	}
+}
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "strict_types/macros.hpp"
+
 /*
 	common.hpp description:
 		This header contains the base types used for type qualifications.
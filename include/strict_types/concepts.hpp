@@ -2,8 +2,12 @@
 
 #include "strict_types/common.hpp"
 
+#include <format>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 /*
 	concepts.hpp description:
@@ -30,6 +34,10 @@ namespace STRICT_TYPES_NAMESPACE {
 		template <typename Type>
 		concept is_strict_alias_type = std::is_base_of_v<STRICT_TYPES_NAMESPACE::details::strict_types_alias_base_t, Type>;
 
+		// Returns true if the value of the strict [Type] is stored as its encapsulated type, so its bytes are those of the raw value.
+		template <typename Type>
+		concept is_natively_stored_type = std::is_same_v<decltype(Type::value), typename Type::type>;
+
 		// Returns true if [Other] is the same as one of the [QualifiedTypes], and if [QualifiedTypes] is a non-zero length.
 		template <typename Other, typename... QualifiedTypes>
 		concept is_qualified_type = (sizeof...(QualifiedTypes) > 0) && (std::is_same_v<Other, QualifiedTypes> || ...);
@@ -108,13 +116,13 @@ namespace STRICT_TYPES_NAMESPACE {
 		template <typename Type, typename Other>
 		concept is_qualified_conversion_function = is_strict_type<Other> || std::is_convertible_v<Type, Other> || std::is_same_v<Type, std::remove_reference_t<Other>>;
 
-		// Returns true if [Type] can be converted to a std::string.
+		// Returns true if [Type] can be converted to a std::string, or a std::string_view a std::string can be constructed from.
 		template <typename Type>
-		concept can_convert_to_string = std::is_convertible_v<Type, std::string>;
+		concept can_convert_to_string = std::is_convertible_v<Type, std::string> || std::is_convertible_v<Type, std::string_view>;
 
-		// Returns true if [Type] can be converted to a std::wstring.
+		// Returns true if [Type] can be converted to a std::wstring, or a std::wstring_view a std::wstring can be constructed from.
 		template <typename Type>
-		concept can_convert_to_wstring = std::is_convertible_v<Type, std::wstring>;
+		concept can_convert_to_wstring = std::is_convertible_v<Type, std::wstring> || std::is_convertible_v<Type, std::wstring_view>;
 
 		// Returns true if [Type] can be converted to a std::string using std::to_string().
 		template <typename Type>
@@ -132,6 +140,14 @@ namespace STRICT_TYPES_NAMESPACE {
 		template <typename Type>
 		concept can_wstringify = can_convert_to_wstring<Type> || can_convert_to_wstring_function<Type>;
 
+		// Returns true if [Type] has an enabled std::formatter specialization for [CharType].
+		template <typename Type, typename CharType = char>
+		concept can_format = std::is_default_constructible_v<std::formatter<Type, CharType>>;
+
+		// Returns true if [Type] has an enabled std::hash specialization.
+		template <typename Type>
+		concept can_hash = std::is_default_constructible_v<std::hash<Type>>;
+
 		// Returns true if [Type] has a .data() function.
 		template <typename Type>
 		concept has_data_function = requires (Type t) { t.data(); };
@@ -203,5 +219,73 @@ namespace STRICT_TYPES_NAMESPACE {
 		// Returns true if [Type] has a .get_allocator() function.
 		template <typename Type>
 		concept has_get_allocator_function = requires (Type t) { t.get_allocator(); };
+
+		// Returns true if [Type] has a .reserve() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_reserve_function = requires (Type t, Args&&... args) { t.reserve(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .resize() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_resize_function = requires (Type t, Args&&... args) { t.resize(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .shrink_to_fit() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_shrink_to_fit_function = requires (Type t, Args&&... args) { t.shrink_to_fit(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .clear() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_clear_function = requires (Type t, Args&&... args) { t.clear(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .assign() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_assign_function = requires (Type t, Args&&... args) { t.assign(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .append() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_append_function = requires (Type t, Args&&... args) { t.append(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .push_back() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_push_back_function = requires (Type t, Args&&... args) { t.push_back(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .emplace_back() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_emplace_back_function = requires (Type t, Args&&... args) { t.emplace_back(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .pop_back() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_pop_back_function = requires (Type t, Args&&... args) { t.pop_back(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .push_front() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_push_front_function = requires (Type t, Args&&... args) { t.push_front(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .emplace_front() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_emplace_front_function = requires (Type t, Args&&... args) { t.emplace_front(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .pop_front() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_pop_front_function = requires (Type t, Args&&... args) { t.pop_front(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .insert() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_insert_function = requires (Type t, Args&&... args) { t.insert(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .emplace() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_emplace_function = requires (Type t, Args&&... args) { t.emplace(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .emplace_hint() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_emplace_hint_function = requires (Type t, Args&&... args) { t.emplace_hint(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .try_emplace() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_try_emplace_function = requires (Type t, Args&&... args) { t.try_emplace(std::forward<Args>(args)...); };
+
+		// Returns true if [Type] has a .erase() function callable with [Args].
+		template <typename Type, typename... Args>
+		concept has_erase_function = requires (Type t, Args&&... args) { t.erase(std::forward<Args>(args)...); };
 	}
 }
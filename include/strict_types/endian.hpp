@@ -0,0 +1,355 @@
+#pragma once
+
+#include "strict_types/checks.hpp"
+#include "strict_types/concepts.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <stdlib.h>
+#endif
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	endian.hpp description:
+		This header file contains byte order helpers: byteswap() for unsigned integral
+		types, lowered to a single bswap/rev instruction, and to_byte_order(), which
+		converts between the native byte order and a fixed one.
+
+		Converting to the native byte order is the identity, so code written against a
+		fixed byte order costs nothing on hosts that already use it.
+
+		It also contains strict integral types stored in a fixed byte order, so structs
+		of them can be overlaid on network or file buffers and read in place:
+
+			struct packet_header {
+					strict::be_uint16_t type;
+					strict::be_uint32_t length;
+			};
+
+			const auto& header = *reinterpret_cast<const packet_header*>(buffer);
+
+			std::uint32_t length = header.length;   // Byteswapped on little-endian hosts.
+
+		They convert implicitly to their native value, and have the same operators as
+		strict_integral_type. The stored value is never exposed as a native integral, so
+		a field cannot be read without its byteswap, and types of different byte orders
+		do not implicitly convert to each other.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The unsigned integral type of [Size] bytes.
+		template <std::size_t Size>
+		using unsigned_of_size_t = std::conditional_t<
+			Size == 1,
+			std::uint8_t,
+			std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::conditional_t<Size == 8, std::uint64_t, void>>>>;
+
+		/// @brief Returns [value] with its bytes in reverse order.
+		/// @tparam Type The unsigned integral type.
+		/// @returns Type
+		template <typename Type>
+			requires std::is_unsigned_v<Type> && (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8)
+		[[nodiscard]] inline constexpr Type byteswap(const Type value) noexcept {
+			if constexpr (sizeof(Type) == 1) return value;
+			else if (std::is_constant_evaluated()) {
+				Type result = 0;
+
+				for (std::size_t i = 0; i < sizeof(Type); ++i) result |= static_cast<Type>(((value >> (i * 8)) & 0xFF) << ((sizeof(Type) - 1 - i) * 8));
+
+				return result;
+			}
+#if defined(__GNUC__) || defined(__clang__)
+			else if constexpr (sizeof(Type) == 2) return __builtin_bswap16(value);
+			else if constexpr (sizeof(Type) == 4) return __builtin_bswap32(value);
+			else return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+			else if constexpr (sizeof(Type) == 2) return _byteswap_ushort(value);
+			else if constexpr (sizeof(Type) == 4) return _byteswap_ulong(value);
+			else return _byteswap_uint64(value);
+#else
+			else {
+				Type result = 0;
+
+				for (std::size_t i = 0; i < sizeof(Type); ++i) result |= static_cast<Type>(((value >> (i * 8)) & 0xFF) << ((sizeof(Type) - 1 - i) * 8));
+
+				return result;
+			}
+#endif
+		}
+
+		/// @brief Converts [value] between the native byte order and [Order]. The conversion is its own inverse.
+		/// @tparam Order The fixed byte order.
+		/// @returns Type
+		template <std::endian Order, typename Type>
+		[[nodiscard]] inline constexpr Type to_byte_order(const Type value) noexcept {
+			static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big, "strict_types: mixed-endian hosts are not supported");
+
+			if constexpr (Order == std::endian::native) return value;
+			else return STRICT_TYPES_NAMESPACE::details::byteswap(value);
+		}
+
+		/// @brief Arithmetic value stored in [Order], converting to and from its native value.
+		///
+		//  The value member of strict_endian_type and strict_unaligned_type, so the operator
+		//  macros of macros.hpp, which operate on .value, read and write the native value.
+		//  Unaligned storage is a byte array, loaded and stored with std::bit_cast (a memcpy),
+		//  which compilers lower to single unaligned moves.
+		/// @tparam Type The native arithmetic type.
+		/// @tparam Order The byte order of the storage.
+		/// @tparam Aligned Whether the storage has the alignment of [Type], or an alignment of 1.
+		template <typename Type, std::endian Order, bool Aligned = true>
+		struct endian_value {
+				using native_type	 = Type;
+				using bits_type	 = STRICT_TYPES_NAMESPACE::details::unsigned_of_size_t<sizeof(Type)>;
+				using storage_type = std::conditional_t<Aligned, bits_type, std::array<std::byte, sizeof(Type)>>;
+
+				storage_type bits = {};
+
+				inline constexpr endian_value() noexcept = default;
+
+				inline constexpr endian_value(const Type value) noexcept :
+					bits(m_store(value)) { }
+
+				/// @brief Returns the native value.
+				/// @returns Type
+				[[nodiscard]] inline constexpr operator Type() const noexcept { return std::bit_cast<Type>(STRICT_TYPES_NAMESPACE::details::to_byte_order<Order>(std::bit_cast<bits_type>(this->bits))); }
+
+				inline constexpr endian_value& operator=(const Type value) noexcept {
+					this->bits = m_store(value);
+					return *this;
+				}
+
+				template <typename Other>
+				inline constexpr endian_value& operator+=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) + other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator-=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) - other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator*=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) * other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator/=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) / other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator%=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) % other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator&=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) & other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator|=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) | other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator^=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) ^ other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator<<=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) << other); }
+
+				template <typename Other>
+				inline constexpr endian_value& operator>>=(const Other other) noexcept { return *this = static_cast<Type>(static_cast<Type>(*this) >> other); }
+
+				/// @brief Pre-increment operator.
+				/// @returns Type The incremented native value.
+				inline constexpr Type operator++() noexcept {
+					Type value = *this;
+					*this		  = ++value;
+					return value;
+				}
+
+				/// @brief Post-increment operator.
+				/// @returns Type The native value before the increment.
+				inline constexpr Type operator++(int) noexcept {
+					Type value = *this;
+					*this		  = static_cast<Type>(value + 1);
+					return value;
+				}
+
+				/// @brief Pre-decrement operator.
+				/// @returns Type The decremented native value.
+				inline constexpr Type operator--() noexcept {
+					Type value = *this;
+					*this		  = --value;
+					return value;
+				}
+
+				/// @brief Post-decrement operator.
+				/// @returns Type The native value before the decrement.
+				inline constexpr Type operator--(int) noexcept {
+					Type value = *this;
+					*this		  = static_cast<Type>(value - 1);
+					return value;
+				}
+
+			protected:
+				[[nodiscard]] inline constexpr static storage_type m_store(const Type value) noexcept { return std::bit_cast<storage_type>(STRICT_TYPES_NAMESPACE::details::to_byte_order<Order>(std::bit_cast<bits_type>(value))); }
+		};
+
+		/// @brief The encapsulated type of [Type] if it is a strict integral type, [Type] otherwise.
+		template <typename Type>
+		struct endian_underlying {
+				using type = Type;
+		};
+
+		template <typename Type>
+			requires is_strict_integral_type<Type>
+		struct endian_underlying<Type> {
+				using type = typename Type::type;
+		};
+	}
+
+	/// @brief Strictly-typed integral-only encapsulation struct stored in a fixed byte order.
+	///
+	//  Requirements:
+	//   - Type must be a 1, 2, 4 or 8-byte integral type other than bool.
+	//   - The size and alignment are those of [Type].
+	//   - The operators are those of integral.hpp, which read and write the native value through .value.
+	/// @tparam Type The native integral type.
+	/// @tparam Order The byte order of the storage.
+	/// @tparam Strict The strict integral type the type was made from, or [Type]. Keeps big_endian<meters_t> and big_endian<seconds_t> distinct.
+	template <typename Type, std::endian Order, typename Strict = Type>
+		requires std::is_integral_v<Type> && (!std::is_same_v<Type, bool>) && (!std::is_void_v<STRICT_TYPES_NAMESPACE::details::unsigned_of_size_t<sizeof(Type)>>)
+	struct strict_endian_type : STRICT_TYPES_NAMESPACE::details::strict_types_integral_base_t {
+			inline constexpr static Type			min	= std::numeric_limits<Type>::min();
+			inline constexpr static Type			max	= std::numeric_limits<Type>::max();
+			inline constexpr static std::endian	order	= Order;
+
+			using type			= Type;
+			using strict_type = Strict;
+			STRICT_TYPES_NAMESPACE::details::endian_value<Type, Order> value = {};
+
+			/// @brief Default constructor.
+			inline constexpr strict_endian_type() noexcept = default;
+
+			/// @brief Implicit copy constructor.
+			/// @tparam Other The implicitly-convertible type.
+			/// @param other The implicitly-convertible value.
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_implicit_constructor<Other, Type>
+			inline constexpr strict_endian_type(const Other other) noexcept :
+				value(static_cast<Type>(other)) { }
+
+			/// @brief Explicit copy constructor.
+			/// @tparam Other The explicitly-convertible type.
+			/// @param other The explicitly-convertible value.
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_constructor<Other, Type>
+			inline constexpr explicit strict_endian_type(const Other other) noexcept :
+				value(static_cast<Type>(other)) {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Type>(other), "strict_types: explicit construction from an out of range value");
+			}
+
+			/// @brief Implicit constructor from the strict type it was made from.
+			/// @param other The strict value.
+			inline constexpr strict_endian_type(const Strict other) noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict>
+				: value(other.value) { }
+
+			/// @brief Returns the native value.
+			/// @returns Type
+			[[nodiscard]] inline constexpr Type get() const noexcept { return this->value; }
+
+			/// @brief Implicit conversion operator, returning the native value.
+			/// @returns Type
+			[[nodiscard]] inline constexpr operator Type() const noexcept { return this->value; }
+
+			/// @brief Implicit conversion operator, returning the value as the strict type it was made from.
+			/// @returns Strict
+			[[nodiscard]] inline constexpr operator Strict() const noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict> {
+				return static_cast<Strict>(this->get());
+			}
+
+			/// @brief Explicit conversion operator.
+			/// @tparam Other The type to convert to.
+			/// @returns Other
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
+			[[nodiscard]] inline constexpr explicit operator Other() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->get()), "strict_types: narrowing conversion of an out of range value");
+
+				return static_cast<Other>(this->get());
+			}
+
+			/// @brief Conversion function.
+			/// @tparam Other The type to convert to.
+			/// @returns Other
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
+			[[nodiscard]] inline constexpr Other as() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->get()), "strict_types: narrowing conversion of an out of range value");
+
+				return static_cast<Other>(this->get());
+			}
+
+			/// @brief Converts to a human-readable string representing the current value.
+			/// @returns std::string
+			[[nodiscard]] inline std::string to_string() const { return std::to_string(+this->get()); }
+
+			/// @brief Converts to a human-readable wide string representing the current value.
+			/// @returns std::wstring
+			[[nodiscard]] inline std::wstring to_wstring() const { return std::to_wstring(+this->get()); }
+	};
+
+	/// @brief Integral type stored in big-endian (network) byte order.
+	/// @tparam Type The integral or strict integral type.
+	template <typename Type>
+	using big_endian = STRICT_TYPES_NAMESPACE::strict_endian_type<typename STRICT_TYPES_NAMESPACE::details::endian_underlying<Type>::type, std::endian::big, Type>;
+
+	/// @brief Integral type stored in little-endian byte order.
+	/// @tparam Type The integral or strict integral type.
+	template <typename Type>
+	using little_endian = STRICT_TYPES_NAMESPACE::strict_endian_type<typename STRICT_TYPES_NAMESPACE::details::endian_underlying<Type>::type, std::endian::little, Type>;
+
+	using be_int16_t	= STRICT_TYPES_NAMESPACE::big_endian<std::int16_t>;
+	using be_int32_t	= STRICT_TYPES_NAMESPACE::big_endian<std::int32_t>;
+	using be_int64_t	= STRICT_TYPES_NAMESPACE::big_endian<std::int64_t>;
+	using be_uint16_t = STRICT_TYPES_NAMESPACE::big_endian<std::uint16_t>;
+	using be_uint32_t = STRICT_TYPES_NAMESPACE::big_endian<std::uint32_t>;
+	using be_uint64_t = STRICT_TYPES_NAMESPACE::big_endian<std::uint64_t>;
+
+	using le_int16_t	= STRICT_TYPES_NAMESPACE::little_endian<std::int16_t>;
+	using le_int32_t	= STRICT_TYPES_NAMESPACE::little_endian<std::int32_t>;
+	using le_int64_t	= STRICT_TYPES_NAMESPACE::little_endian<std::int64_t>;
+	using le_uint16_t = STRICT_TYPES_NAMESPACE::little_endian<std::uint16_t>;
+	using le_uint32_t = STRICT_TYPES_NAMESPACE::little_endian<std::uint32_t>;
+	using le_uint64_t = STRICT_TYPES_NAMESPACE::little_endian<std::uint64_t>;
+}
+
+template <typename Type, std::endian Order, typename Strict, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::strict_endian_type<Type, Order, Strict>, CharType> : std::formatter<decltype(+Type {}), CharType> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::strict_endian_type<Type, Order, Strict> value, FormatContext& context) const {
+			return std::formatter<decltype(+Type {}), CharType>::format(+value.get(), context);
+		}
+};
+
+template <typename Type, std::endian Order, typename Strict>
+struct std::hash<STRICT_TYPES_NAMESPACE::strict_endian_type<Type, Order, Strict>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::strict_endian_type<Type, Order, Strict> value) const noexcept {
+			return std::hash<Type> {}(value.get());
+		}
+};
+
+STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(be_uint32_t)
+STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(le_uint32_t)
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
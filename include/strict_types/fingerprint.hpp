@@ -0,0 +1,161 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/hash.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	fingerprint.hpp description:
+		This header file contains layout fingerprints: a constexpr 64-bit hash of the
+		layout of a type, to validate memory-mapped files and shared memory with a single
+		compare instead of a field-by-field schema check.
+
+			static_assert(strict::layout_fingerprint_v<strict::uint32_t> != strict::layout_fingerprint_v<strict::size32_t>);
+
+		The fingerprint of an arithmetic type hashes its kind, size, alignment and
+		signedness. Strict types defined by the STRICT_TYPES_DEFINE_*_TYPE macros also
+		hash their name and the fingerprint of their encapsulated type, so strict types
+		of the same layout but different meanings do not match. Aggregates list their
+		members with STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT, which hashes the
+		fingerprint and offset of every member:
+
+			struct packet_header {
+					strict::be_uint16_t type;
+					strict::be_uint32_t length;
+			};
+
+			STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT(packet_header, type, length)
+
+		Fingerprints do not depend on STRICT_TYPES_NAMESPACE or the compiler, except
+		for types with no structural fingerprint (such as standard library containers),
+		which hash their name as spelled by the compiler.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief Returns the name of [Type] as spelled by the compiler, such as "strict::uint32_t".
+		/// @returns std::string_view
+		template <typename Type>
+		[[nodiscard]] inline constexpr std::string_view type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+			// "... type_name() [with Type = strict::uint32_t; ...]" on GCC, "... type_name() [Type = strict::uint32_t]" on clang.
+			constexpr std::string_view function = __PRETTY_FUNCTION__;
+			constexpr std::string_view prefix	= "Type = ";
+			constexpr std::size_t		begin		= function.find(prefix) + prefix.size();
+
+			return function.substr(begin, function.find_first_of(";]", begin) - begin);
+#elif defined(_MSC_VER)
+			// "... type_name<struct strict::uint32_t>(void) noexcept".
+			constexpr std::string_view function = __FUNCSIG__;
+			constexpr std::size_t		begin		= function.find("type_name<") + 10;
+
+			return function.substr(begin, function.rfind(">(void)") - begin);
+#else
+			return "";
+#endif
+		}
+
+		/// @brief Combines [value] into the fingerprint [seed].
+		/// @returns std::uint64_t
+		[[nodiscard]] inline constexpr std::uint64_t combine_fingerprint(const std::uint64_t seed, const std::uint64_t value) noexcept {
+			return STRICT_TYPES_NAMESPACE::details::mix_bits(seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2)));
+		}
+
+		/// @brief Combines [text] into the fingerprint [seed] (FNV-1a).
+		/// @returns std::uint64_t
+		[[nodiscard]] inline constexpr std::uint64_t combine_fingerprint(const std::uint64_t seed, const std::string_view text) noexcept {
+			std::uint64_t hash = 0xCBF29CE484222325ULL;
+
+			for (const char character : text) hash = (hash ^ static_cast<unsigned char>(character)) * 0x100000001B3ULL;
+
+			return STRICT_TYPES_NAMESPACE::details::combine_fingerprint(seed, hash);
+		}
+
+		/// @brief Returns the structural fingerprint of [Type], used unless layout_fingerprint is specialized.
+		/// @returns std::uint64_t
+		template <typename Type>
+		[[nodiscard]] inline constexpr std::uint64_t default_layout_fingerprint() noexcept;
+
+		/// @brief The fingerprint and offset of a member of an aggregate.
+		struct member_layout {
+				std::uint64_t fingerprint = 0;
+				std::size_t	  offset		 = 0;
+		};
+	}
+
+	/// @brief The constexpr 64-bit fingerprint of the layout of [Type].
+	///
+	//  Specialized by the STRICT_TYPES_DEFINE_*_TYPE macros, and by
+	//  STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT for aggregates.
+	/// @tparam Type The type to fingerprint.
+	template <typename Type>
+	struct layout_fingerprint : std::integral_constant<std::uint64_t, STRICT_TYPES_NAMESPACE::details::default_layout_fingerprint<Type>()> { };
+
+	template <typename Type>
+	inline constexpr std::uint64_t layout_fingerprint_v = STRICT_TYPES_NAMESPACE::layout_fingerprint<std::remove_cv_t<Type>>::value;
+
+	namespace details {
+		template <typename Type>
+		[[nodiscard]] inline constexpr std::uint64_t default_layout_fingerprint() noexcept {
+			std::uint64_t fingerprint = combine_fingerprint(combine_fingerprint(0, sizeof(Type)), alignof(Type));
+
+			if constexpr (std::is_same_v<Type, bool>) return combine_fingerprint(fingerprint, "bool");
+			else if constexpr (std::is_integral_v<Type>) return combine_fingerprint(combine_fingerprint(fingerprint, "integral"), std::is_signed_v<Type>);
+			else if constexpr (std::is_floating_point_v<Type>) return combine_fingerprint(combine_fingerprint(fingerprint, "float"), std::numeric_limits<Type>::digits);
+			else if constexpr (std::is_enum_v<Type>) return combine_fingerprint(combine_fingerprint(fingerprint, "enum"), layout_fingerprint_v<std::underlying_type_t<Type>>);
+			else if constexpr (std::is_bounded_array_v<Type>) {
+				fingerprint = combine_fingerprint(combine_fingerprint(fingerprint, "array"), std::extent_v<Type>);
+				return combine_fingerprint(fingerprint, layout_fingerprint_v<std::remove_extent_t<Type>>);
+			}
+			else if constexpr (is_strict_type<Type> || is_strict_alias_type<Type>) {
+				fingerprint = combine_fingerprint(combine_fingerprint(fingerprint, "strict"), layout_fingerprint_v<typename Type::type>);
+
+				// Types stored in a fixed byte order, such as strict::big_endian.
+				if constexpr (requires { Type::order; }) fingerprint = combine_fingerprint(fingerprint, static_cast<std::uint64_t>(Type::order));
+
+				// Types made from another strict type, such as strict::saturating<meters_t>.
+				if constexpr (requires { typename Type::strict_type; }) {
+					if constexpr (!std::is_same_v<typename Type::strict_type, typename Type::type>) fingerprint = combine_fingerprint(fingerprint, layout_fingerprint_v<typename Type::strict_type>);
+				}
+
+				return fingerprint;
+			}
+			else return combine_fingerprint(combine_fingerprint(fingerprint, "opaque"), type_name<Type>());
+		}
+
+		/// @brief Returns the fingerprint of the strict type [Type] named [name].
+		/// @returns std::uint64_t
+		template <typename Type>
+		[[nodiscard]] inline constexpr std::uint64_t strict_layout_fingerprint(const std::string_view name) noexcept {
+			return combine_fingerprint(default_layout_fingerprint<Type>(), name);
+		}
+
+		/// @brief Returns the fingerprint of the aggregate [Type] named [name], made of [members] in declaration order.
+		/// @returns std::uint64_t
+		template <typename Type>
+			requires std::is_standard_layout_v<Type>
+		[[nodiscard]] inline constexpr std::uint64_t aggregate_layout_fingerprint(const std::string_view name, const std::initializer_list<member_layout> members) noexcept {
+			std::uint64_t fingerprint = combine_fingerprint(combine_fingerprint(combine_fingerprint(0, sizeof(Type)), alignof(Type)), name);
+
+			for (const member_layout& member : members) fingerprint = combine_fingerprint(combine_fingerprint(fingerprint, member.fingerprint), member.offset);
+
+			return fingerprint;
+		}
+	}
+}
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
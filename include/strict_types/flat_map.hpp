@@ -0,0 +1,437 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/hash.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+
+	#define STRICT_TYPES_FLAT_MAP_SSE2
+#endif
+
+/*
+	flat_map.hpp description:
+		This header file contains a flat open-addressing hash map keyed by strict
+		integral types. Keys and values are stored in two separate contiguous
+		arrays (structure of arrays), so a lookup only touches the key array until
+		the key is found.
+
+		Keys are probed in 16-byte groups: every key of a group is compared against
+		the searched key at once (with SSE2 when available), and an empty slot in the
+		group ends the search. Empty slots hold the reserved sentinel key Key::max,
+		which therefore cannot be inserted. Collisions are resolved by linear
+		probing, and erasing shifts the following keys back, so the table never
+		accumulates tombstones.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The number of [Type] keys in one 16-byte probe group.
+		/// @tparam Type The raw key type.
+		template <typename Type>
+		inline constexpr std::size_t flat_map_group_width = 16 / sizeof(Type);
+
+		/// @brief Returns a mask of the keys in the probe group at [group] that are equal to [key].
+		///
+		//  Each key occupies sizeof(Type) consecutive bits of the mask, so the index of the first
+		//  equal key is std::countr_zero(mask) / sizeof(Type).
+		/// @tparam Type The raw key type.
+		/// @param group The first key of the probe group.
+		/// @param key The searched key.
+		/// @returns std::uint32_t
+		template <typename Type>
+		[[nodiscard]] inline std::uint32_t flat_map_match(const Type* group, const Type key) noexcept {
+#if defined(STRICT_TYPES_FLAT_MAP_SSE2)
+			const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+			if constexpr (sizeof(Type) == 1) return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(key)))));
+			else if constexpr (sizeof(Type) == 2) return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(keys, _mm_set1_epi16(static_cast<short>(key)))));
+			else if constexpr (sizeof(Type) == 4) return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(keys, _mm_set1_epi32(static_cast<int>(key)))));
+			else {
+				// SSE2 has no 64-bit compare: a key is equal when both of its 32-bit halves are equal.
+				const __m128i halves = _mm_cmpeq_epi32(keys, _mm_set1_epi64x(static_cast<long long>(key)));
+
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)))));
+			}
+#else
+			std::uint32_t mask = 0;
+
+			for (std::size_t i = 0; i < STRICT_TYPES_NAMESPACE::details::flat_map_group_width<Type>; ++i) {
+				mask |= static_cast<std::uint32_t>(group[i] == key) << (i * sizeof(Type));
+			}
+
+			return mask;
+#endif
+		}
+
+		/// @brief Owns an array of [Type] allocated by std::allocator until it is released.
+		/// @tparam Type The element type of the array.
+		template <typename Type>
+		struct allocation_guard {
+				Type*			data	= nullptr;
+				std::size_t	count	= 0;
+
+				/// @brief Allocates [count] uninitialized elements.
+				inline explicit allocation_guard(const std::size_t count) :
+					data(std::allocator<Type> {}.allocate(count)), count(count) { }
+
+				allocation_guard(const allocation_guard&)				  = delete;
+				allocation_guard& operator=(const allocation_guard&) = delete;
+
+				/// @brief Deallocates the array, unless it was released.
+				inline ~allocation_guard() noexcept {
+					if (this->data != nullptr) std::allocator<Type> {}.deallocate(this->data, this->count);
+				}
+
+				/// @brief Gives up ownership of the array.
+				/// @returns Type*
+				[[nodiscard]] inline Type* release() noexcept { return std::exchange(this->data, nullptr); }
+		};
+	}
+
+	/// @brief Flat open-addressing hash map keyed by a strict integral type.
+	///
+	//  Requirements:
+	//   - Key must be a trivially-copyable strict integral type.
+	//   - Key::max is reserved as the empty-slot sentinel and cannot be inserted.
+	/// @tparam Key The strict integral key type.
+	/// @tparam Value The mapped type.
+	/// @tparam Hash The key hasher, strict::mixing_hash by default.
+	template <typename Key, typename Value, typename Hash = STRICT_TYPES_NAMESPACE::mixing_hash<Key>>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Key> && std::is_trivially_copyable_v<Key>
+	struct flat_map {
+		protected:
+			using raw_key_type = typename Key::type;
+
+			inline constexpr static std::size_t	 group_width = STRICT_TYPES_NAMESPACE::details::flat_map_group_width<raw_key_type>;
+			inline constexpr static raw_key_type sentinel	 = Key::max;
+			inline constexpr static std::size_t	 not_found	 = static_cast<std::size_t>(-1);
+
+			/// @brief Iterator over the occupied slots, yielding (key, value reference) pairs.
+			///
+			//  Keys are stored as raw keys, so there is no (key, value) pair in the table to point to:
+			//  operator* returns the pair by value, and operator-> returns it inside an arrow_proxy.
+			/// @tparam MapValue The (const-qualified) mapped type.
+			template <typename MapValue>
+			struct basic_iterator {
+					using iterator_category	= std::forward_iterator_tag;
+					using difference_type	= std::ptrdiff_t;
+					using value_type			= std::pair<Key, MapValue&>;
+					using reference			= std::pair<Key, MapValue&>;
+
+					/// @brief Holds the pair returned by operator->, for it->first and it->second.
+					struct arrow_proxy {
+							reference pair;
+
+							[[nodiscard]] inline reference* operator->() noexcept { return &this->pair; }
+					};
+
+					const raw_key_type* keys	  = nullptr;
+					MapValue*			  values	  = nullptr;
+					std::size_t			  slot	  = 0;
+					std::size_t			  capacity = 0;
+
+					[[nodiscard]] inline reference operator*() const noexcept { return {static_cast<Key>(this->keys[this->slot]), this->values[this->slot]}; }
+
+					[[nodiscard]] inline arrow_proxy operator->() const noexcept { return {**this}; }
+
+					inline basic_iterator& operator++() noexcept {
+						do ++this->slot;
+						while (this->slot < this->capacity && this->keys[this->slot] == sentinel);
+
+						return *this;
+					}
+
+					inline basic_iterator operator++(int) noexcept {
+						basic_iterator previous = *this;
+						++*this;
+						return previous;
+					}
+
+					[[nodiscard]] inline bool operator==(const basic_iterator& other) const noexcept { return this->slot == other.slot; }
+			};
+
+		public:
+			using key_type			= Key;
+			using mapped_type		= Value;
+			using hasher			= Hash;
+			using size_type		= std::size_t;
+			using iterator			= basic_iterator<Value>;
+			using const_iterator	= basic_iterator<const Value>;
+
+			/// @brief Default constructor. Does not allocate.
+			inline flat_map() noexcept = default;
+
+			/// @brief Copy constructor.
+			inline flat_map(const flat_map& other) {
+				if (other.m_capacity == 0) return;
+
+				// Copied into a local map first: if a Value copy throws, its destructor
+				// releases both arrays and every value copied so far.
+				flat_map copy;
+				copy.m_allocate(other.m_capacity);
+
+				for (std::size_t slot = 0; slot < other.m_capacity; ++slot) {
+					if (other.m_keys[slot] == sentinel) continue;
+
+					std::construct_at(copy.m_values + slot, other.m_values[slot]);
+					copy.m_keys[slot] = other.m_keys[slot];
+					++copy.m_size;
+				}
+
+				*this = std::move(copy);
+			}
+
+			/// @brief Move constructor.
+			inline flat_map(flat_map&& other) noexcept :
+				m_keys(std::exchange(other.m_keys, nullptr)),
+				m_values(std::exchange(other.m_values, nullptr)),
+				m_size(std::exchange(other.m_size, 0)),
+				m_capacity(std::exchange(other.m_capacity, 0)) { }
+
+			/// @brief Copy assignment operator.
+			inline flat_map& operator=(const flat_map& other) {
+				if (this != &other) *this = flat_map(other);
+				return *this;
+			}
+
+			/// @brief Move assignment operator.
+			inline flat_map& operator=(flat_map&& other) noexcept {
+				if (this != &other) {
+					this->m_release();
+
+					this->m_keys	  = std::exchange(other.m_keys, nullptr);
+					this->m_values	  = std::exchange(other.m_values, nullptr);
+					this->m_size	  = std::exchange(other.m_size, 0);
+					this->m_capacity = std::exchange(other.m_capacity, 0);
+				}
+
+				return *this;
+			}
+
+			/// @brief Destructor.
+			inline ~flat_map() noexcept { this->m_release(); }
+
+			/// @brief Returns the number of stored keys.
+			/// @returns std::size_t
+			[[nodiscard]] inline std::size_t size() const noexcept { return this->m_size; }
+
+			/// @brief Returns the number of slots in the table.
+			/// @returns std::size_t
+			[[nodiscard]] inline std::size_t capacity() const noexcept { return this->m_capacity; }
+
+			/// @brief Returns true if no key is stored.
+			/// @returns bool
+			[[nodiscard]] inline bool empty() const noexcept { return this->m_size == 0; }
+
+			/// @brief Returns a pointer to the value mapped to [key], or nullptr if [key] is not stored.
+			/// @returns Value*
+			[[nodiscard]] inline Value* find(const Key key) noexcept {
+				const std::size_t slot = this->m_find(static_cast<raw_key_type>(key.value));
+				return slot == not_found ? nullptr : this->m_values + slot;
+			}
+
+			/// @brief Returns a pointer to the value mapped to [key], or nullptr if [key] is not stored.
+			/// @returns const Value*
+			[[nodiscard]] inline const Value* find(const Key key) const noexcept {
+				const std::size_t slot = this->m_find(static_cast<raw_key_type>(key.value));
+				return slot == not_found ? nullptr : this->m_values + slot;
+			}
+
+			/// @brief Returns true if [key] is stored.
+			/// @returns bool
+			[[nodiscard]] inline bool contains(const Key key) const noexcept { return this->m_find(static_cast<raw_key_type>(key.value)) != not_found; }
+
+			/// @brief Constructs a value for [key] from [args] if [key] is not stored yet.
+			/// @returns std::pair<Value*, bool> The mapped value, and true if it was inserted.
+			template <typename... Args>
+			inline std::pair<Value*, bool> try_emplace(const Key key, Args&&... args) {
+				const raw_key_type raw_key = static_cast<raw_key_type>(key.value);
+
+				STRICT_TYPES_ASSERT(raw_key != sentinel, "flat_map: Key::max is reserved as the empty-slot sentinel");
+
+				if (const std::size_t slot = this->m_find(raw_key); slot != not_found) return {this->m_values + slot, false};
+
+				if ((this->m_size + 1) * 8 > this->m_capacity * 7) this->m_rehash(this->m_capacity == 0 ? group_width * 2 : this->m_capacity * 2);
+
+				const std::size_t slot = this->m_find_empty(raw_key);
+
+				std::construct_at(this->m_values + slot, std::forward<Args>(args)...);
+				this->m_keys[slot] = raw_key;
+				++this->m_size;
+
+				return {this->m_values + slot, true};
+			}
+
+			/// @brief Inserts [value] for [key] if [key] is not stored yet.
+			/// @returns bool True if [value] was inserted.
+			inline bool insert(const Key key, const Value& value) { return this->try_emplace(key, value).second; }
+
+			/// @brief Inserts [value] for [key] if [key] is not stored yet.
+			/// @returns bool True if [value] was inserted.
+			inline bool insert(const Key key, Value&& value) { return this->try_emplace(key, std::move(value)).second; }
+
+			/// @brief Returns the value mapped to [key], default-constructing it if [key] is not stored yet.
+			/// @returns Value&
+			template <typename _ = void>
+				requires std::is_default_constructible_v<Value>
+			inline Value& operator[](const Key key) {
+				return *this->try_emplace(key).first;
+			}
+
+			/// @brief Erases [key] and its value.
+			/// @returns bool True if [key] was stored.
+			inline bool erase(const Key key) noexcept(std::is_nothrow_move_assignable_v<Value>) {
+				std::size_t hole = this->m_find(static_cast<raw_key_type>(key.value));
+
+				if (hole == not_found) return false;
+
+				// Backward-shift deletion: every following key that may legally move into the
+				// hole does so, which keeps each key reachable from its home slot without gaps.
+				const std::size_t mask = this->m_capacity - 1;
+
+				for (std::size_t slot = (hole + 1) & mask; this->m_keys[slot] != sentinel; slot = (slot + 1) & mask) {
+					const std::size_t home = this->m_home(this->m_keys[slot]);
+
+					if (((slot - home) & mask) < ((slot - hole) & mask)) continue;
+
+					this->m_values[hole]	= std::move(this->m_values[slot]);
+					this->m_keys[hole]	= this->m_keys[slot];
+					hole						= slot;
+				}
+
+				std::destroy_at(this->m_values + hole);
+				this->m_keys[hole] = sentinel;
+				--this->m_size;
+
+				return true;
+			}
+
+			/// @brief Erases every key and value. Keeps the allocated table.
+			inline void clear() noexcept {
+				for (std::size_t slot = 0; slot < this->m_capacity; ++slot) {
+					if (this->m_keys[slot] == sentinel) continue;
+
+					std::destroy_at(this->m_values + slot);
+					this->m_keys[slot] = sentinel;
+				}
+
+				this->m_size = 0;
+			}
+
+			/// @brief Grows the table so that [count] keys fit without rehashing.
+			inline void reserve(const std::size_t count) {
+				const std::size_t capacity = std::bit_ceil(std::max(group_width * 2, (count * 8 + 6) / 7));
+
+				if (capacity > this->m_capacity) this->m_rehash(capacity);
+			}
+
+			[[nodiscard]] inline iterator			begin() noexcept { return {this->m_keys, this->m_values, this->m_first_slot(), this->m_capacity}; }
+			[[nodiscard]] inline const_iterator	begin() const noexcept { return {this->m_keys, this->m_values, this->m_first_slot(), this->m_capacity}; }
+			[[nodiscard]] inline iterator			end() noexcept { return {this->m_keys, this->m_values, this->m_capacity, this->m_capacity}; }
+			[[nodiscard]] inline const_iterator	end() const noexcept { return {this->m_keys, this->m_values, this->m_capacity, this->m_capacity}; }
+
+		protected:
+			raw_key_type* m_keys		 = nullptr;
+			Value*		  m_values	 = nullptr;
+			std::size_t	  m_size		 = 0;
+			std::size_t	  m_capacity = 0;
+
+			inline std::size_t m_first_slot() const noexcept {
+				std::size_t slot = 0;
+
+				while (slot < this->m_capacity && this->m_keys[slot] == sentinel) ++slot;
+
+				return slot;
+			}
+
+			inline std::size_t m_home(const raw_key_type raw_key) const noexcept {
+				return Hash {}(static_cast<Key>(raw_key)) & (this->m_capacity - 1);
+			}
+
+			// Walks the probe groups from the home slot of [raw_key], and returns the first slot
+			// holding [target]. Slots of the first group that come before the home slot are skipped.
+			inline std::size_t m_probe(const raw_key_type raw_key, const raw_key_type target, const bool stop_at_empty) const noexcept {
+				const std::size_t	home	= this->m_home(raw_key);
+				std::size_t			group	= home & ~(group_width - 1);
+				std::uint32_t		skip	= ~std::uint32_t {0} << ((home - group) * sizeof(raw_key_type));
+
+				while (true) {
+					const std::uint32_t matches = STRICT_TYPES_NAMESPACE::details::flat_map_match(this->m_keys + group, target) & skip;
+
+					if (matches != 0) return group + static_cast<std::size_t>(std::countr_zero(matches)) / sizeof(raw_key_type);
+
+					if (stop_at_empty && (STRICT_TYPES_NAMESPACE::details::flat_map_match(this->m_keys + group, sentinel) & skip) != 0) return not_found;
+
+					group	= (group + group_width) & (this->m_capacity - 1);
+					skip	= ~std::uint32_t {0};
+				}
+			}
+
+			inline std::size_t m_find(const raw_key_type raw_key) const noexcept {
+				if (this->m_size == 0 || raw_key == sentinel) return not_found;
+				return this->m_probe(raw_key, raw_key, true);
+			}
+
+			inline std::size_t m_find_empty(const raw_key_type raw_key) const noexcept { return this->m_probe(raw_key, sentinel, false); }
+
+			// Allocates the arrays of an empty map. Both arrays are allocated before either
+			// member is assigned, so a throwing second allocation does not leak the first.
+			inline void m_allocate(const std::size_t capacity) {
+				STRICT_TYPES_NAMESPACE::details::allocation_guard<raw_key_type> keys(capacity);
+				Value* const values = std::allocator<Value> {}.allocate(capacity);
+
+				this->m_keys	  = keys.release();
+				this->m_values	  = values;
+				this->m_capacity = capacity;
+
+				std::uninitialized_fill_n(this->m_keys, capacity, sentinel);
+			}
+
+			inline void m_release() noexcept {
+				if (this->m_capacity == 0) return;
+
+				this->clear();
+
+				std::allocator<raw_key_type> {}.deallocate(this->m_keys, this->m_capacity);
+				std::allocator<Value> {}.deallocate(this->m_values, this->m_capacity);
+
+				this->m_keys	  = nullptr;
+				this->m_values	  = nullptr;
+				this->m_capacity = 0;
+			}
+
+			// Rebuilds the table with [capacity] slots. The entries are relocated into a local
+			// map, which only replaces [this] once every entry is in it: if an allocation or a
+			// Value copy throws, the local map is released and [this] is left unchanged.
+			// Values are copied instead of moved when their move constructor may throw.
+			inline void m_rehash(const std::size_t capacity) {
+				flat_map next;
+				next.m_allocate(capacity);
+
+				for (std::size_t slot = 0; slot < this->m_capacity; ++slot) {
+					if (this->m_keys[slot] == sentinel) continue;
+
+					const std::size_t target = next.m_find_empty(this->m_keys[slot]);
+
+					std::construct_at(next.m_values + target, std::move_if_noexcept(this->m_values[slot]));
+					next.m_keys[target] = this->m_keys[slot];
+					++next.m_size;
+				}
+
+				*this = std::move(next);
+			}
+	};
+}
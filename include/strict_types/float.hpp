@@ -1,10 +1,13 @@
 #pragma once
 
+#include "strict_types/checks.hpp"
 #include "strict_types/concepts.hpp"
+#include "strict_types/fingerprint.hpp"
 #include "strict_types/macros.hpp"
 
 #include <cmath>
 #include <format>
+#include <functional>
 #include <limits>
 #include <string>
 #include <type_traits>
@@ -60,7 +63,9 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_constructor<Other, Type>
 			inline constexpr explicit strict_float_type(const Other other) noexcept :
-				value(static_cast<Type>(other)) { }
+				value(static_cast<Type>(other)) {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Type>(other), "strict_types: explicit construction from an out of range value");
+			}
 
 			/// @brief Implicit conversion operator.
 			/// @returns Type&
@@ -76,6 +81,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
 			[[nodiscard]] inline constexpr explicit operator Other() noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<Other>(this->value);
 			}
 
@@ -85,6 +92,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
 			[[nodiscard]] inline constexpr explicit operator const Other() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<const Other>(this->value);
 			}
 
@@ -94,6 +103,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
 			[[nodiscard]] inline constexpr Other as() noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<Other>(this->value);
 			}
 
@@ -103,6 +114,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
 			[[nodiscard]] inline constexpr const Other as() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<const Other>(this->value);
 			}
 
@@ -133,8 +146,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		return static_cast<Left>(std::fmod(left.value, right.value));
 #else
-		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) return static_cast<Left>(std::fmodf(left.value, right.value));
-		else return static_cast<Left>(std::fmodl(left.value, right.value));
+		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) return static_cast<Left>(::fmodf(left.value, right.value));
+		else return static_cast<Left>(::fmodl(left.value, right.value));
 #endif
 	}
 
@@ -148,8 +161,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		return static_cast<Left>(std::fmod(left.value, right));
 #else
-		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<Right, float>) return static_cast<Left>(std::fmodf(left.value, right));
-		else return static_cast<Left>(std::fmodl(left.value, right));
+		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<Right, float>) return static_cast<Left>(::fmodf(left.value, right));
+		else return static_cast<Left>(::fmodl(left.value, right));
 #endif
 	}
 
@@ -163,8 +176,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		return static_cast<Left>(std::fmod(left, right.value));
 #else
-		if constexpr (std::is_same_v<Left, float> && std::is_same_v<typename Right::type, float>) return static_cast<Left>(std::fmodf(left, right.value));
-		else return static_cast<Left>(std::fmodl(left, right.value));
+		if constexpr (std::is_same_v<Left, float> && std::is_same_v<typename Right::type, float>) return static_cast<Left>(::fmodf(left, right.value));
+		else return static_cast<Left>(::fmodl(left, right.value));
 #endif
 	}
 
@@ -178,8 +191,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		left.value = static_cast<typename Left::type>(std::fmod(left.value, right.value));
 #else
-		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) left.value = static_cast<typename Left::type>(std::fmodf(left.value, right.value));
-		else left.value = static_cast<typename Left::type>(std::fmodl(left.value, right.value));
+		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) left.value = static_cast<typename Left::type>(::fmodf(left.value, right.value));
+		else left.value = static_cast<typename Left::type>(::fmodl(left.value, right.value));
 #endif
 
 		return left;
@@ -195,8 +208,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		left.value = static_cast<typename Left::type>(std::fmod(left.value, right));
 #else
-		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<Right, float>) left.value = static_cast<typename Left::type>(std::fmodf(left.value, right));
-		else left.value = static_cast<typename Left::type>(std::fmodl(left.value, right));
+		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<Right, float>) left.value = static_cast<typename Left::type>(::fmodf(left.value, right));
+		else left.value = static_cast<typename Left::type>(::fmodl(left.value, right));
 #endif
 
 		return left;
@@ -212,8 +225,8 @@ namespace STRICT_TYPES_NAMESPACE {
 #if __cplusplus >= 202203L
 		left = static_cast<typename Left::type>(std::fmod(left, right.value));
 #else
-		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) left = static_cast<typename Left::type>(std::fmodf(left, right.value));
-		else left = static_cast<typename Left::type>(std::fmodl(left, right.value));
+		if constexpr (std::is_same_v<typename Left::type, float> && std::is_same_v<typename Right::type, float>) left = static_cast<typename Left::type>(::fmodf(left, right.value));
+		else left = static_cast<typename Left::type>(::fmodl(left, right.value));
 #endif
 
 		return left;
@@ -232,29 +245,32 @@ namespace STRICT_TYPES_NAMESPACE {
 // =============================================================================
 
 //	Defines a strict float-only type.
-#define STRICT_TYPES_DEFINE_FLOAT_TYPE(NAME, TYPE, QUALIFIED_TYPES...)                                 \
-	namespace STRICT_TYPES_NAMESPACE {                                                                  \
-		struct NAME : STRICT_TYPES_NAMESPACE::strict_float_type<TYPE, QUALIFIED_TYPES> {                 \
-				using STRICT_TYPES_NAMESPACE::strict_float_type<TYPE, QUALIFIED_TYPES>::strict_float_type; \
-                                                                                                       \
-				template <typename Other>                                                                  \
-					requires STRICT_TYPES_NAMESPACE::details::is_qualified_float_assignment_operator<Other> \
-				inline constexpr NAME& operator=(const Other other) noexcept {                             \
-					if constexpr (std::is_floating_point_v<Other>) this->value = static_cast<TYPE>(other);  \
-					else this->value = static_cast<TYPE>(other.value);                                      \
-					return *this;                                                                           \
-				}                                                                                          \
-		};                                                                                               \
-	}                                                                                                   \
-	STRICT_TYPES_DEFINE_FORMATTER(NAME)
+#define STRICT_TYPES_DEFINE_FLOAT_TYPE(NAME, TYPE, QUALIFIED_TYPES...)                                   \
+	namespace STRICT_TYPES_NAMESPACE {                                                                    \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_float_type<TYPE, ##QUALIFIED_TYPES> {                 \
+				using STRICT_TYPES_NAMESPACE::strict_float_type<TYPE, ##QUALIFIED_TYPES>::strict_float_type; \
+                                                                                                         \
+				template <typename Other>                                                                    \
+					requires STRICT_TYPES_NAMESPACE::details::is_qualified_float_assignment_operator<Other>   \
+				inline constexpr NAME& operator=(const Other other) noexcept {                               \
+					if constexpr (std::is_floating_point_v<Other>) this->value = static_cast<TYPE>(other);    \
+					else this->value = static_cast<TYPE>(other.value);                                        \
+					return *this;                                                                             \
+				}                                                                                            \
+		};                                                                                                 \
+	}                                                                                                     \
+	STRICT_TYPES_DEFINE_FORMATTER(NAME)                                                                   \
+	STRICT_TYPES_DEFINE_HASH(NAME)                                                                        \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME)                                                           \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME)
 
 //	Defines a strict dynamic float-only type.
 #define STRICT_TYPES_DEFINE_DYNAMIC_FLOAT_TYPE(NAME, QUALIFIED_TYPES...)                               \
 	namespace STRICT_TYPES_NAMESPACE {                                                                  \
 		template <typename T>                                                                            \
 			requires STRICT_TYPES_NAMESPACE::details::is_qualified_float_type<QUALIFIED_TYPES>            \
-		struct NAME : STRICT_TYPES_NAMESPACE::strict_float_type<T, QUALIFIED_TYPES> {                    \
-				using STRICT_TYPES_NAMESPACE::strict_float_type<T, QUALIFIED_TYPES>::strict_float_type;    \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_float_type<T, ##QUALIFIED_TYPES> {                  \
+				using STRICT_TYPES_NAMESPACE::strict_float_type<T, ##QUALIFIED_TYPES>::strict_float_type;  \
                                                                                                        \
 				template <typename Other>                                                                  \
 					requires STRICT_TYPES_NAMESPACE::details::is_qualified_float_assignment_operator<Other> \
@@ -266,8 +282,17 @@ namespace STRICT_TYPES_NAMESPACE {
 		};                                                                                               \
 	}                                                                                                   \
 	STRICT_TYPES_DEFINE_FORMATTER(NAME<float>)                                                          \
+	STRICT_TYPES_DEFINE_HASH(NAME<float>)                                                               \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<float>)                                                  \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<float>)                                                 \
 	STRICT_TYPES_DEFINE_FORMATTER(NAME<double>)                                                         \
-	STRICT_TYPES_DEFINE_FORMATTER(NAME<long double>)
+	STRICT_TYPES_DEFINE_HASH(NAME<double>)                                                              \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<double>)                                                 \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<double>)                                                \
+	STRICT_TYPES_DEFINE_FORMATTER(NAME<long double>)                                                    \
+	STRICT_TYPES_DEFINE_HASH(NAME<long double>)                                                         \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<long double>)                                            \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<long double>)
 
 // =============================================================================
 // Pre-defined common types
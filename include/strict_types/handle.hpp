@@ -0,0 +1,113 @@
+#pragma once
+
+#include "strict_types/macros.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <type_traits>
+
+/*
+	handle.hpp description:
+		This header file contains generational handles: a slot index and a generation
+		packed into a single 32-bit or 64-bit word, distinguished by a tag type.
+
+			struct texture_tag;
+			using texture_handle = strict::handle<texture_tag>;          // 24 + 8 bits.
+			using entity_handle  = strict::handle<entity_tag, 32, 32>;   // 32 + 32 bits.
+
+		A container bumps the generation of a slot each time it is reused, so a handle
+		kept after its object was erased no longer matches the slot (the ABA problem).
+		Handles with different tags cannot be mixed, and stay as cheap to copy, compare
+		and hash as the integral word they are stored in.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Generational handle packing a slot index and a generation into one word.
+	///
+	//  Requirements:
+	//   - IndexBits + GenerationBits must not exceed 64.
+	//   - The largest index is reserved for the null handle.
+	/// @tparam Tag The tag type distinguishing unrelated handles. May be incomplete.
+	/// @tparam IndexBits The number of low bits holding the slot index.
+	/// @tparam GenerationBits The number of high bits holding the generation.
+	template <typename Tag, std::size_t IndexBits = 24, std::size_t GenerationBits = 8>
+		requires (IndexBits > 0) && (GenerationBits > 0) && (IndexBits + GenerationBits <= 64)
+	struct handle {
+			using tag_type = Tag;
+			using type		= std::conditional_t<(IndexBits + GenerationBits <= 32), std::uint32_t, std::uint64_t>;
+
+			inline constexpr static std::size_t index_bits		 = IndexBits;
+			inline constexpr static std::size_t generation_bits = GenerationBits;
+			inline constexpr static type			index_mask		 = (type {1} << IndexBits) - 1;
+			inline constexpr static type			generation_mask = (type {1} << GenerationBits) - 1;
+			inline constexpr static type			null_value		 = index_mask | (generation_mask << IndexBits);
+
+			/// @brief The largest index usable by a slot; the index of the null handle is one past it.
+			inline constexpr static type max_index = index_mask - 1;
+
+			type value = null_value;
+
+			/// @brief Default constructor, constructing the null handle.
+			inline constexpr handle() noexcept = default;
+
+			/// @brief Constructs a handle to slot [index] at [generation].
+			/// @param index The slot index, at most max_index.
+			/// @param generation The generation, wrapped to GenerationBits.
+			inline constexpr handle(const type index, const type generation) noexcept :
+				value((index & index_mask) | ((generation & generation_mask) << IndexBits)) {
+				STRICT_TYPES_ASSERT(index <= max_index, "handle: index out of range");
+			}
+
+			/// @brief Reconstructs a handle from its packed [value], such as one read from a file.
+			/// @returns handle
+			[[nodiscard]] inline constexpr static handle from_value(const type value) noexcept {
+				handle result;
+				result.value = value;
+				return result;
+			}
+
+			/// @brief Returns the slot index.
+			/// @returns type
+			[[nodiscard]] inline constexpr type index() const noexcept { return this->value & index_mask; }
+
+			/// @brief Returns the generation.
+			/// @returns type
+			[[nodiscard]] inline constexpr type generation() const noexcept { return this->value >> IndexBits; }
+
+			/// @brief Returns true if this is the null handle.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool is_null() const noexcept { return this->value == null_value; }
+
+			/// @brief Returns true if this is not the null handle.
+			/// @returns bool
+			[[nodiscard]] inline constexpr explicit operator bool() const noexcept { return !this->is_null(); }
+
+			[[nodiscard]] inline constexpr friend bool operator==(const handle left, const handle right) noexcept = default;
+			[[nodiscard]] inline constexpr friend auto operator<=>(const handle left, const handle right) noexcept = default;
+	};
+}
+
+template <typename Tag, std::size_t IndexBits, std::size_t GenerationBits, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits>, CharType> : std::formatter<typename STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits>::type, CharType> {
+		// Formats as "index:generation", applying the format-spec to both numbers.
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits> value, FormatContext& context) const {
+			using base_type = std::formatter<typename STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits>::type, CharType>;
+
+			auto output = base_type::format(value.index(), context);
+			*output++	= static_cast<CharType>(':');
+			context.advance_to(output);
+
+			return base_type::format(value.generation(), context);
+		}
+};
+
+template <typename Tag, std::size_t IndexBits, std::size_t GenerationBits>
+struct std::hash<STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits> value) const noexcept {
+			return std::hash<typename STRICT_TYPES_NAMESPACE::handle<Tag, IndexBits, GenerationBits>::type> {}(value.value);
+		}
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+	hash.hpp description:
+		This header file contains an opt-in hasher with strong bit mixing for
+		integral and strict integral keys. The std::hash specializations of
+		strict types are defined by the type-defining macros, and hash the same
+		as the encapsulated type. For integers that is the identity on libstdc++
+		and libc++, which clusters sequential ids such as index_t or count_t in
+		open-addressing hash tables.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief Mixes every bit of [value] into every bit of the result (MurmurHash3 64-bit finalizer).
+		/// @param value The value to mix.
+		/// @returns std::uint64_t
+		[[nodiscard]] inline constexpr std::uint64_t mix_bits(std::uint64_t value) noexcept {
+			value ^= value >> 33;
+			value *= 0xFF51AFD7ED558CCDULL;
+			value ^= value >> 33;
+			value *= 0xC4CEB9FE1A85EC53ULL;
+			value ^= value >> 33;
+
+			return value;
+		}
+	}
+
+	/// @brief Hasher with strong bit mixing for integral and strict integral keys.
+	///
+	//  Usage example:
+	//     std::unordered_map<strict::index_t, T, strict::mixing_hash<strict::index_t>> map;
+	/// @tparam Type The hashed type.
+	template <typename Type>
+		requires std::is_integral_v<Type> || STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Type>
+	struct mixing_hash {
+			/// @brief Returns the mixed hash of [value].
+			/// @returns std::size_t
+			[[nodiscard]] inline constexpr std::size_t operator()(const Type value) const noexcept {
+				if constexpr (std::is_integral_v<Type>) return static_cast<std::size_t>(STRICT_TYPES_NAMESPACE::details::mix_bits(static_cast<std::uint64_t>(value)));
+				else return static_cast<std::size_t>(STRICT_TYPES_NAMESPACE::details::mix_bits(static_cast<std::uint64_t>(value.value)));
+			}
+	};
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+	indexed_vector.hpp description:
+		This header file contains a vector that can only be indexed by one specific
+		strict integral index type, and an iota-style range of strict indices.
+
+		Raw integers and other strict index types are rejected at compile time, so
+		indices of different tables cannot be mixed up. Subscripting is bounds checked
+		through STRICT_TYPES_ASSERT, which compiles away in release builds, so loops over
+		index_range stay as cheap as loops over raw integers.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Iota-style half-open range of strict indices [first, last).
+	/// @tparam IndexT The strict integral index type.
+	template <typename IndexT>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<IndexT>
+	struct index_range {
+			/// @brief Iterator yielding consecutive strict indices.
+			struct iterator {
+					using iterator_category	= std::forward_iterator_tag;
+					using difference_type	= std::ptrdiff_t;
+					using value_type			= IndexT;
+					using reference			= IndexT;
+
+					typename IndexT::type value = {};
+
+					[[nodiscard]] inline constexpr IndexT operator*() const noexcept { return static_cast<IndexT>(this->value); }
+
+					inline constexpr iterator& operator++() noexcept {
+						++this->value;
+						return *this;
+					}
+
+					inline constexpr iterator operator++(int) noexcept {
+						iterator previous = *this;
+						++this->value;
+						return previous;
+					}
+
+					[[nodiscard]] inline constexpr bool operator==(const iterator& other) const noexcept = default;
+			};
+
+			typename IndexT::type first = {};
+			typename IndexT::type last	 = {};
+
+			/// @brief Default constructor. Constructs an empty range.
+			inline constexpr index_range() noexcept = default;
+
+			/// @brief Constructs the range [0, last).
+			inline constexpr explicit index_range(const IndexT last) noexcept :
+				last(last.value) { }
+
+			/// @brief Constructs the range [first, last).
+			inline constexpr index_range(const IndexT first, const IndexT last) noexcept :
+				first(first.value), last(last.value) { }
+
+			[[nodiscard]] inline constexpr iterator begin() const noexcept { return {this->first}; }
+			[[nodiscard]] inline constexpr iterator end() const noexcept { return {this->last}; }
+
+			/// @brief Returns the number of indices in the range.
+			/// @returns IndexT
+			[[nodiscard]] inline constexpr IndexT size() const noexcept { return static_cast<IndexT>(this->last - this->first); }
+
+			/// @brief Returns true if the range holds no index.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool empty() const noexcept { return this->first == this->last; }
+	};
+
+	/// @brief Vector indexed by one specific strict integral index type.
+	///
+	//  Requirements:
+	//   - IndexT must be a strict integral type.
+	//   - Subscripting with anything other than IndexT does not compile.
+	/// @tparam IndexT The strict integral index type.
+	/// @tparam Type The element type.
+	/// @tparam Allocator The allocator of the underlying std::vector.
+	template <typename IndexT, typename Type, typename Allocator = std::allocator<Type>>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<IndexT>
+	struct indexed_vector {
+			using index_type		 = IndexT;
+			using value_type		 = Type;
+			using vector_type		 = std::vector<Type, Allocator>;
+			using iterator			 = typename vector_type::iterator;
+			using const_iterator	 = typename vector_type::const_iterator;
+			using reference		 = typename vector_type::reference;
+			using const_reference = typename vector_type::const_reference;
+
+			/// @brief Default constructor.
+			inline constexpr indexed_vector() noexcept(std::is_nothrow_default_constructible_v<vector_type>) = default;
+
+			/// @brief Constructs [count] value-initialized elements.
+			inline constexpr explicit indexed_vector(const IndexT count) :
+				m_values(static_cast<std::size_t>(count.value)) { }
+
+			/// @brief Constructs [count] copies of [value].
+			inline constexpr indexed_vector(const IndexT count, const Type& value) :
+				m_values(static_cast<std::size_t>(count.value), value) { }
+
+			/// @brief Initializer list constructor.
+			inline constexpr indexed_vector(std::initializer_list<Type> values) :
+				m_values(values) { }
+
+			/// @brief Returns the element at [index]. [index] is bounds checked by STRICT_TYPES_ASSERT.
+			/// @returns Type&
+			[[nodiscard]] inline constexpr reference operator[](const IndexT index) noexcept {
+				STRICT_TYPES_ASSERT(static_cast<std::size_t>(index.value) < this->m_values.size(), "indexed_vector: index out of range");
+				return this->m_values[static_cast<std::size_t>(index.value)];
+			}
+
+			/// @brief Returns the element at [index]. [index] is bounds checked by STRICT_TYPES_ASSERT.
+			/// @returns const Type&
+			[[nodiscard]] inline constexpr const_reference operator[](const IndexT index) const noexcept {
+				STRICT_TYPES_ASSERT(static_cast<std::size_t>(index.value) < this->m_values.size(), "indexed_vector: index out of range");
+				return this->m_values[static_cast<std::size_t>(index.value)];
+			}
+
+			/// @brief Rejects every index that is not exactly IndexT, including raw integers.
+			template <typename Other>
+			reference operator[](const Other index) = delete;
+
+			/// @brief Rejects every index that is not exactly IndexT, including raw integers.
+			template <typename Other>
+			const_reference operator[](const Other index) const = delete;
+
+			/// @brief Returns the number of elements.
+			/// @returns IndexT
+			[[nodiscard]] inline constexpr IndexT size() const noexcept { return static_cast<IndexT>(this->m_values.size()); }
+
+			/// @brief Returns the number of elements that fit without reallocating.
+			/// @returns IndexT
+			[[nodiscard]] inline constexpr IndexT capacity() const noexcept { return static_cast<IndexT>(this->m_values.capacity()); }
+
+			/// @brief Returns true if there are no elements.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool empty() const noexcept { return this->m_values.empty(); }
+
+			/// @brief Returns the range of every valid index, [0, size()).
+			/// @returns index_range<IndexT>
+			[[nodiscard]] inline constexpr STRICT_TYPES_NAMESPACE::index_range<IndexT> indices() const noexcept {
+				return STRICT_TYPES_NAMESPACE::index_range<IndexT>(this->size());
+			}
+
+			/// @brief Reserves storage for [count] elements.
+			inline constexpr void reserve(const IndexT count) { this->m_values.reserve(static_cast<std::size_t>(count.value)); }
+
+			/// @brief Resizes to [count] elements.
+			inline constexpr void resize(const IndexT count) { this->m_values.resize(static_cast<std::size_t>(count.value)); }
+
+			/// @brief Resizes to [count] elements, copying [value] into new elements.
+			inline constexpr void resize(const IndexT count, const Type& value) { this->m_values.resize(static_cast<std::size_t>(count.value), value); }
+
+			/// @brief Appends [value] and returns its index.
+			/// @returns IndexT
+			inline constexpr IndexT push_back(const Type& value) {
+				this->m_values.push_back(value);
+				return static_cast<IndexT>(this->m_values.size() - 1);
+			}
+
+			/// @brief Appends [value] and returns its index.
+			/// @returns IndexT
+			inline constexpr IndexT push_back(Type&& value) {
+				this->m_values.push_back(std::move(value));
+				return static_cast<IndexT>(this->m_values.size() - 1);
+			}
+
+			/// @brief Constructs an element in-place at the end and returns its index.
+			/// @returns IndexT
+			template <typename... Args>
+			inline constexpr IndexT emplace_back(Args&&... args) {
+				this->m_values.emplace_back(std::forward<Args>(args)...);
+				return static_cast<IndexT>(this->m_values.size() - 1);
+			}
+
+			/// @brief Removes the last element.
+			inline constexpr void pop_back() noexcept {
+				STRICT_TYPES_ASSERT(!this->m_values.empty(), "indexed_vector: pop_back() on an empty vector");
+				this->m_values.pop_back();
+			}
+
+			/// @brief Removes every element.
+			inline constexpr void clear() noexcept { this->m_values.clear(); }
+
+			[[nodiscard]] inline constexpr Type*			 data() noexcept { return this->m_values.data(); }
+			[[nodiscard]] inline constexpr const Type*	 data() const noexcept { return this->m_values.data(); }
+			[[nodiscard]] inline constexpr iterator		 begin() noexcept { return this->m_values.begin(); }
+			[[nodiscard]] inline constexpr const_iterator begin() const noexcept { return this->m_values.begin(); }
+			[[nodiscard]] inline constexpr iterator		 end() noexcept { return this->m_values.end(); }
+			[[nodiscard]] inline constexpr const_iterator end() const noexcept { return this->m_values.end(); }
+
+			/// @brief Returns the underlying std::vector.
+			/// @returns const std::vector<Type, Allocator>&
+			[[nodiscard]] inline constexpr const vector_type& as_vector() const noexcept { return this->m_values; }
+
+		protected:
+			vector_type m_values;
+	};
+}
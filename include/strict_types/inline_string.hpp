@@ -0,0 +1,262 @@
+#pragma once
+
+#include "strict_types/macros.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	inline_string.hpp description:
+		This header file contains a fixed-capacity string stored entirely inline,
+		with no heap allocation, and usable as the encapsulated type of a strict
+		alias type:
+
+			STRICT_TYPES_DEFINE_ALIAS_TYPE(request_key, strict::inline_string<22>)
+
+		strict::inline_string<22> is 24 bytes, the same size as std::string on most
+		standard libraries, but holds up to 22 characters without allocating. It is
+		trivially copyable, so containers of inline strings copy with memcpy.
+
+		Inline strings convert implicitly to std::basic_string_view, which provides
+		the to_string() and formatter paths of strict alias types.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The smallest unsigned integral type holding [Capacity].
+		template <std::size_t Capacity>
+		using inline_string_size_t = std::conditional_t<
+			(Capacity <= UINT8_MAX),
+			std::uint8_t,
+			std::conditional_t<(Capacity <= UINT16_MAX), std::uint16_t, std::conditional_t<(Capacity <= UINT32_MAX), std::uint32_t, std::size_t>>>;
+
+		// Returns true if [Type] is a string type convertible to a std::basic_string_view<CharType>,
+		// other than a character pointer or array, which are constructed through the character pointer constructor.
+		template <typename Type, typename CharType>
+		concept is_inline_string_view_like = std::is_convertible_v<const Type&, std::basic_string_view<CharType>> && (!std::is_convertible_v<const Type&, const CharType*>);
+	}
+
+	/// @brief Fixed-capacity, null-terminated string stored inline.
+	///
+	//  Requirements:
+	//   - Text longer than [Capacity] is an assertion failure, and is truncated to
+	//     [Capacity] characters when assertions are disabled.
+	/// @tparam Capacity The largest number of characters, excluding the null terminator.
+	/// @tparam CharType The character type.
+	template <std::size_t Capacity, typename CharType = char>
+		requires (Capacity > 0)
+	struct basic_inline_string {
+			using value_type				  = CharType;
+			using traits_type				  = std::char_traits<CharType>;
+			using view_type				  = std::basic_string_view<CharType>;
+			using size_type				  = STRICT_TYPES_NAMESPACE::details::inline_string_size_t<Capacity>;
+			using difference_type		  = std::ptrdiff_t;
+			using reference				  = CharType&;
+			using const_reference		  = const CharType&;
+			using pointer					  = CharType*;
+			using const_pointer			  = const CharType*;
+			using iterator					  = CharType*;
+			using const_iterator			  = const CharType*;
+			using reverse_iterator		  = std::reverse_iterator<iterator>;
+			using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+			/// @brief Default constructor, constructing the empty string.
+			inline constexpr basic_inline_string() noexcept = default;
+
+			/// @brief Constructs a copy of the null-terminated [text].
+			inline constexpr basic_inline_string(const CharType* text) noexcept { this->assign(view_type(text)); }
+
+			/// @brief Constructs a copy of the first [count] characters of [text].
+			inline constexpr basic_inline_string(const CharType* text, const std::size_t count) noexcept { this->assign(view_type(text, count)); }
+
+			/// @brief Constructs a copy of [text], such as a std::basic_string or std::basic_string_view.
+			/// @tparam Other The string type, convertible to view_type.
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_inline_string_view_like<Other, CharType>
+			inline constexpr basic_inline_string(const Other& text) noexcept { this->assign(view_type(text)); }
+
+			/// @brief Returns true if [text] fits without truncation.
+			/// @returns bool
+			[[nodiscard]] inline constexpr static bool fits(const view_type text) noexcept { return text.size() <= Capacity; }
+
+			/// @brief Replaces the contents with [text].
+			/// @returns basic_inline_string&
+			inline constexpr basic_inline_string& assign(const view_type text) noexcept {
+				STRICT_TYPES_ASSERT(fits(text), "inline_string: text exceeds the capacity");
+
+				this->m_size = static_cast<size_type>(std::min(text.size(), Capacity));
+				// [text] may be a piece of this string, such as view().substr(1), so the ranges may overlap.
+				traits_type::move(this->m_data, text.data(), this->m_size);
+				this->m_data[this->m_size] = CharType {};
+
+				return *this;
+			}
+
+			/// @brief Replaces the contents with [text].
+			/// @tparam Other The string type, convertible to view_type.
+			/// @returns basic_inline_string&
+			template <typename Other>
+				requires std::is_convertible_v<const Other&, std::basic_string_view<CharType>> && (!std::is_same_v<Other, basic_inline_string>)
+			inline constexpr basic_inline_string& operator=(const Other& text) noexcept { return this->assign(view_type(text)); }
+
+			/// @brief Appends [text].
+			/// @returns basic_inline_string&
+			inline constexpr basic_inline_string& append(const view_type text) noexcept {
+				STRICT_TYPES_ASSERT(text.size() <= Capacity - this->m_size, "inline_string: text exceeds the capacity");
+
+				const auto count = static_cast<size_type>(std::min<std::size_t>(text.size(), Capacity - this->m_size));
+				traits_type::copy(this->m_data + this->m_size, text.data(), count);
+				this->m_size += count;
+				this->m_data[this->m_size] = CharType {};
+
+				return *this;
+			}
+
+			/// @brief Appends [text].
+			/// @returns basic_inline_string&
+			inline constexpr basic_inline_string& operator+=(const view_type text) noexcept { return this->append(text); }
+
+			/// @brief Appends [character].
+			inline constexpr void push_back(const CharType character) noexcept {
+				STRICT_TYPES_ASSERT(this->m_size < Capacity, "inline_string: push_back on a full string");
+
+				if (this->m_size == Capacity) return;
+
+				this->m_data[this->m_size++] = character;
+				this->m_data[this->m_size]	  = CharType {};
+			}
+
+			/// @brief Removes the last character.
+			inline constexpr void pop_back() noexcept {
+				STRICT_TYPES_ASSERT(this->m_size > 0, "inline_string: pop_back on an empty string");
+
+				this->m_data[--this->m_size] = CharType {};
+			}
+
+			/// @brief Resizes to [count] characters, filling new characters with [character].
+			inline constexpr void resize(const std::size_t count, const CharType character = CharType {}) noexcept {
+				STRICT_TYPES_ASSERT(count <= Capacity, "inline_string: resize exceeds the capacity");
+
+				const auto size = static_cast<size_type>(std::min(count, Capacity));
+				if (size > this->m_size) traits_type::assign(this->m_data + this->m_size, size - this->m_size, character);
+
+				this->m_size					= size;
+				this->m_data[this->m_size]	= CharType {};
+			}
+
+			/// @brief Erases every character.
+			inline constexpr void clear() noexcept {
+				this->m_size	 = 0;
+				this->m_data[0] = CharType {};
+			}
+
+			[[nodiscard]] inline constexpr CharType* data() noexcept { return this->m_data; }
+			[[nodiscard]] inline constexpr const CharType* data() const noexcept { return this->m_data; }
+			[[nodiscard]] inline constexpr const CharType* c_str() const noexcept { return this->m_data; }
+			[[nodiscard]] inline constexpr std::size_t size() const noexcept { return this->m_size; }
+			[[nodiscard]] inline constexpr std::size_t length() const noexcept { return this->m_size; }
+			[[nodiscard]] inline constexpr bool empty() const noexcept { return this->m_size == 0; }
+			[[nodiscard]] inline constexpr static std::size_t capacity() noexcept { return Capacity; }
+			[[nodiscard]] inline constexpr static std::size_t max_size() noexcept { return Capacity; }
+
+			[[nodiscard]] inline constexpr iterator begin() noexcept { return this->m_data; }
+			[[nodiscard]] inline constexpr const_iterator begin() const noexcept { return this->m_data; }
+			[[nodiscard]] inline constexpr iterator end() noexcept { return this->m_data + this->m_size; }
+			[[nodiscard]] inline constexpr const_iterator end() const noexcept { return this->m_data + this->m_size; }
+			[[nodiscard]] inline constexpr const_iterator cbegin() const noexcept { return this->begin(); }
+			[[nodiscard]] inline constexpr const_iterator cend() const noexcept { return this->end(); }
+			[[nodiscard]] inline constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+			[[nodiscard]] inline constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+			[[nodiscard]] inline constexpr reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+			[[nodiscard]] inline constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+			[[nodiscard]] inline constexpr const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+			[[nodiscard]] inline constexpr const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+			[[nodiscard]] inline constexpr CharType& front() noexcept { return this->m_data[0]; }
+			[[nodiscard]] inline constexpr const CharType& front() const noexcept { return this->m_data[0]; }
+			[[nodiscard]] inline constexpr CharType& back() noexcept { return this->m_data[this->m_size - 1]; }
+			[[nodiscard]] inline constexpr const CharType& back() const noexcept { return this->m_data[this->m_size - 1]; }
+
+			/// @brief Subscript operator. [index] is checked by STRICT_TYPES_ASSERT.
+			/// @returns CharType&
+			[[nodiscard]] inline constexpr CharType& operator[](const std::size_t index) noexcept {
+				STRICT_TYPES_ASSERT(index < this->m_size, "inline_string: index out of range");
+				return this->m_data[index];
+			}
+
+			/// @brief Const subscript operator. [index] is checked by STRICT_TYPES_ASSERT.
+			/// @returns const CharType&
+			[[nodiscard]] inline constexpr const CharType& operator[](const std::size_t index) const noexcept {
+				STRICT_TYPES_ASSERT(index < this->m_size, "inline_string: index out of range");
+				return this->m_data[index];
+			}
+
+			/// @brief Returns a view of the characters.
+			/// @returns view_type
+			[[nodiscard]] inline constexpr view_type view() const noexcept { return view_type(this->m_data, this->m_size); }
+
+			/// @brief Implicit conversion operator.
+			/// @returns view_type
+			[[nodiscard]] inline constexpr operator view_type() const noexcept { return this->view(); }
+
+			[[nodiscard]] inline constexpr friend bool operator==(const basic_inline_string& left, const basic_inline_string& right) noexcept { return left.view() == right.view(); }
+
+			template <typename Other>
+				requires std::is_convertible_v<const Other&, std::basic_string_view<CharType>> && (!std::is_same_v<Other, basic_inline_string>)
+			[[nodiscard]] inline constexpr friend bool operator==(const basic_inline_string& left, const Other& right) noexcept {
+				return left.view() == view_type(right);
+			}
+
+			[[nodiscard]] inline constexpr friend auto operator<=>(const basic_inline_string& left, const basic_inline_string& right) noexcept { return left.view() <=> right.view(); }
+
+			template <typename Other>
+				requires std::is_convertible_v<const Other&, std::basic_string_view<CharType>> && (!std::is_same_v<Other, basic_inline_string>)
+			[[nodiscard]] inline constexpr friend auto operator<=>(const basic_inline_string& left, const Other& right) noexcept {
+				return left.view() <=> view_type(right);
+			}
+
+		protected:
+			CharType	 m_data[Capacity + 1] = {};
+			size_type m_size					 = 0;
+	};
+
+	/// @brief Fixed-capacity string of up to [Capacity] chars, stored inline.
+	template <std::size_t Capacity>
+	using inline_string = STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, char>;
+
+	/// @brief Fixed-capacity string of up to [Capacity] wchar_ts, stored inline.
+	template <std::size_t Capacity>
+	using inline_wstring = STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, wchar_t>;
+}
+
+template <std::size_t Capacity, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, CharType>, CharType> : std::formatter<std::basic_string_view<CharType>, CharType> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, CharType>& value, FormatContext& context) const {
+			return std::formatter<std::basic_string_view<CharType>, CharType>::format(value.view(), context);
+		}
+};
+
+template <std::size_t Capacity, typename CharType>
+struct std::hash<STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, CharType>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::basic_inline_string<Capacity, CharType>& value) const noexcept {
+			return std::hash<std::basic_string_view<CharType>> {}(value.view());
+		}
+};
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "macros.hpp"
+#include "strict_types/checks.hpp"
 #include "strict_types/concepts.hpp"
+#include "strict_types/fingerprint.hpp"
 #include "strict_types/macros.hpp"
 
 #include <cstdint>
 #include <format>
+#include <functional>
 #include <limits>
 #include <string>
 #include <type_traits>
@@ -53,7 +56,9 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_constructor<Other, Type>
 			inline constexpr explicit strict_integral_type(const Other other) noexcept :
-				value(static_cast<Type>(other)) { }
+				value(static_cast<Type>(other)) {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Type>(other), "strict_types: explicit construction from an out of range value");
+			}
 
 			/// @brief Implicit conversion operator.
 			/// @returns Type&
@@ -69,6 +74,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
 			[[nodiscard]] inline constexpr explicit operator Other() noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<Other>(this->value);
 			}
 
@@ -78,6 +85,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
 			[[nodiscard]] inline constexpr explicit operator const Other() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<const Other>(this->value);
 			}
 
@@ -87,6 +96,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
 			[[nodiscard]] inline constexpr Other as() noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<Other>(this->value);
 			}
 
@@ -96,6 +107,8 @@ namespace STRICT_TYPES_NAMESPACE {
 			template <typename Other>
 				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
 			[[nodiscard]] inline constexpr const Other as() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->value), "strict_types: narrowing conversion of an out of range value");
+
 				return static_cast<const Other>(this->value);
 			}
 
@@ -143,85 +156,169 @@ namespace STRICT_TYPES_NAMESPACE {
 // =============================================================================
 
 //	Defines a strict integral-only type.
-#define STRICT_TYPES_DEFINE_INTEGRAL_TYPE(NAME, TYPE, QUALIFIED_TYPES...)                                    \
-	namespace STRICT_TYPES_NAMESPACE {                                                                        \
-		struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<TYPE, QUALIFIED_TYPES> {                    \
-				using STRICT_TYPES_NAMESPACE::strict_integral_type<TYPE, QUALIFIED_TYPES>::strict_integral_type; \
-				template <typename Other>                                                                        \
-					requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other>    \
-				inline constexpr NAME& operator=(const Other other) noexcept {                                   \
-					if constexpr (std::is_integral_v<Other>) this->value = static_cast<TYPE>(other);              \
-					else this->value = static_cast<TYPE>(other.value);                                            \
-                                                                                                             \
-					return *this;                                                                                 \
-				}                                                                                                \
-		};                                                                                                     \
-	}                                                                                                         \
-	STRICT_TYPES_DEFINE_FORMATTER(NAME)
+#define STRICT_TYPES_DEFINE_INTEGRAL_TYPE(NAME, TYPE, QUALIFIED_TYPES...)                                      \
+	namespace STRICT_TYPES_NAMESPACE {                                                                          \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<TYPE, ##QUALIFIED_TYPES> {                    \
+				using STRICT_TYPES_NAMESPACE::strict_integral_type<TYPE, ##QUALIFIED_TYPES>::strict_integral_type; \
+				template <typename Other>                                                                          \
+					requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other>      \
+				inline constexpr NAME& operator=(const Other other) noexcept {                                     \
+					if constexpr (std::is_integral_v<Other>) this->value = static_cast<TYPE>(other);                \
+					else this->value = static_cast<TYPE>(other.value);                                              \
+                                                                                                               \
+					return *this;                                                                                   \
+				}                                                                                                  \
+		};                                                                                                       \
+	}                                                                                                           \
+	STRICT_TYPES_DEFINE_FORMATTER(NAME)                                                                         \
+	STRICT_TYPES_DEFINE_HASH(NAME)                                                                              \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME)                                                                 \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME)
 
 #if defined(__cpp_char8_t)
 	//	Defines a strict dynamic integral-only type.
-	#define STRICT_TYPES_DEFINE_DYNAMIC_INTEGRAL_TYPE(NAME, QUALIFIED_TYPES...)                               \
-		namespace STRICT_TYPES_NAMESPACE {                                                                     \
-			template <typename T>                                                                               \
-				requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_type<QUALIFIED_TYPES>            \
-			struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<T, QUALIFIED_TYPES> {                    \
-					using STRICT_TYPES_NAMESPACE::strict_integral_type<T, QUALIFIED_TYPES>::strict_integral_type; \
-					template <typename Other>                                                                     \
-						requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other> \
-					inline constexpr NAME& operator=(const Other other) noexcept {                                \
-						if constexpr (std::is_integral_v<Other>) this->value = static_cast<T>(other);              \
-						else this->value = static_cast<T>(other.value);                                            \
-                                                                                                             \
-						return *this;                                                                              \
-					}                                                                                             \
-			};                                                                                                  \
-		}                                                                                                      \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char>)                                                              \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned char>)                                                     \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<signed char>)                                                       \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char8_t>)                                                           \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char16_t>)                                                          \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char32_t>)                                                          \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<short>)                                                             \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned short>)                                                    \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<int>)                                                               \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned int>)                                                      \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<long>)                                                              \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long>)                                                     \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<long long>)                                                         \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long long>)
+	#define STRICT_TYPES_DEFINE_DYNAMIC_INTEGRAL_TYPE(NAME, QUALIFIED_TYPES...)                                 \
+		namespace STRICT_TYPES_NAMESPACE {                                                                       \
+			template <typename T>                                                                                 \
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_type<QUALIFIED_TYPES>              \
+			struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<T, ##QUALIFIED_TYPES> {                    \
+					using STRICT_TYPES_NAMESPACE::strict_integral_type<T, ##QUALIFIED_TYPES>::strict_integral_type; \
+					template <typename Other>                                                                       \
+						requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other>   \
+					inline constexpr NAME& operator=(const Other other) noexcept {                                  \
+						if constexpr (std::is_integral_v<Other>) this->value = static_cast<T>(other);                \
+						else this->value = static_cast<T>(other.value);                                              \
+                                                                                                               \
+						return *this;                                                                                \
+					}                                                                                               \
+			};                                                                                                    \
+		}                                                                                                        \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char>)                                                                \
+		STRICT_TYPES_DEFINE_HASH(NAME<char>)                                                                     \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char>)                                                        \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char>)                                                       \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned char>)                                                       \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned char>)                                                            \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned char>)                                               \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned char>)                                              \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<signed char>)                                                         \
+		STRICT_TYPES_DEFINE_HASH(NAME<signed char>)                                                              \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<signed char>)                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<signed char>)                                                \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char8_t>)                                                             \
+		STRICT_TYPES_DEFINE_HASH(NAME<char8_t>)                                                                  \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char8_t>)                                                     \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char8_t>)                                                    \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char16_t>)                                                            \
+		STRICT_TYPES_DEFINE_HASH(NAME<char16_t>)                                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char16_t>)                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char16_t>)                                                   \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char32_t>)                                                            \
+		STRICT_TYPES_DEFINE_HASH(NAME<char32_t>)                                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char32_t>)                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char32_t>)                                                   \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<short>)                                                               \
+		STRICT_TYPES_DEFINE_HASH(NAME<short>)                                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<short>)                                                       \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<short>)                                                      \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned short>)                                                      \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned short>)                                                           \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned short>)                                              \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned short>)                                             \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<int>)                                                                 \
+		STRICT_TYPES_DEFINE_HASH(NAME<int>)                                                                      \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<int>)                                                         \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<int>)                                                        \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned int>)                                                        \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned int>)                                                             \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned int>)                                                \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned int>)                                               \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<long>)                                                                \
+		STRICT_TYPES_DEFINE_HASH(NAME<long>)                                                                     \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<long>)                                                        \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<long>)                                                       \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long>)                                                       \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned long>)                                                            \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned long>)                                               \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned long>)                                              \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<long long>)                                                           \
+		STRICT_TYPES_DEFINE_HASH(NAME<long long>)                                                                \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<long long>)                                                   \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<long long>)                                                  \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long long>)                                                  \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned long long>)                                                       \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned long long>)                                          \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned long long>)
 #else
 	//	Defines a strict dynamic integral-only type.
-	#define STRICT_TYPES_DEFINE_DYNAMIC_INTEGRAL_TYPE(NAME, QUALIFIED_TYPES...)                               \
-		namespace STRICT_TYPES_NAMESPACE {                                                                     \
-			template <typename T>                                                                               \
-				requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_type<QUALIFIED_TYPES>            \
-			struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<T, QUALIFIED_TYPES> {                    \
-					using STRICT_TYPES_NAMESPACE::strict_integral_type<T, QUALIFIED_TYPES>::strict_integral_type; \
-					template <typename Other>                                                                     \
-						requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other> \
-					inline constexpr auto& operator=(const Other other) noexcept {                                \
-						if constexpr (std::is_integral_v<Other>) this->value = static_cast<T>(other);              \
-						else this->value = static_cast<T>(other.value);                                            \
-                                                                                                             \
-						return *this;                                                                              \
-					}                                                                                             \
-			};                                                                                                  \
-		}                                                                                                      \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char>)                                                              \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned char>)                                                     \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<signed char>)                                                       \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char16_t>)                                                          \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<char32_t>)                                                          \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<short>)                                                             \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned short>)                                                    \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<int>)                                                               \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned int>)                                                      \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<long>)                                                              \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long>)                                                     \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<long long>)                                                         \
-		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long long>)
+	#define STRICT_TYPES_DEFINE_DYNAMIC_INTEGRAL_TYPE(NAME, QUALIFIED_TYPES...)                                 \
+		namespace STRICT_TYPES_NAMESPACE {                                                                       \
+			template <typename T>                                                                                 \
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_type<QUALIFIED_TYPES>              \
+			struct NAME : STRICT_TYPES_NAMESPACE::strict_integral_type<T, ##QUALIFIED_TYPES> {                    \
+					using STRICT_TYPES_NAMESPACE::strict_integral_type<T, ##QUALIFIED_TYPES>::strict_integral_type; \
+					template <typename Other>                                                                       \
+						requires STRICT_TYPES_NAMESPACE::details::is_qualified_integral_assignment_operator<Other>   \
+					inline constexpr auto& operator=(const Other other) noexcept {                                  \
+						if constexpr (std::is_integral_v<Other>) this->value = static_cast<T>(other);                \
+						else this->value = static_cast<T>(other.value);                                              \
+                                                                                                               \
+						return *this;                                                                                \
+					}                                                                                               \
+			};                                                                                                    \
+		}                                                                                                        \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char>)                                                                \
+		STRICT_TYPES_DEFINE_HASH(NAME<char>)                                                                     \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char>)                                                        \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char>)                                                       \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned char>)                                                       \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned char>)                                                            \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned char>)                                               \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned char>)                                              \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<signed char>)                                                         \
+		STRICT_TYPES_DEFINE_HASH(NAME<signed char>)                                                              \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<signed char>)                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<signed char>)                                                \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char16_t>)                                                            \
+		STRICT_TYPES_DEFINE_HASH(NAME<char16_t>)                                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char16_t>)                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char16_t>)                                                   \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<char32_t>)                                                            \
+		STRICT_TYPES_DEFINE_HASH(NAME<char32_t>)                                                                 \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<char32_t>)                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<char32_t>)                                                   \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<short>)                                                               \
+		STRICT_TYPES_DEFINE_HASH(NAME<short>)                                                                    \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<short>)                                                       \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<short>)                                                      \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned short>)                                                      \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned short>)                                                           \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned short>)                                              \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned short>)                                             \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<int>)                                                                 \
+		STRICT_TYPES_DEFINE_HASH(NAME<int>)                                                                      \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<int>)                                                         \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<int>)                                                        \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned int>)                                                        \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned int>)                                                             \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned int>)                                                \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned int>)                                               \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<long>)                                                                \
+		STRICT_TYPES_DEFINE_HASH(NAME<long>)                                                                     \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<long>)                                                        \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<long>)                                                       \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long>)                                                       \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned long>)                                                            \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned long>)                                               \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned long>)                                              \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<long long>)                                                           \
+		STRICT_TYPES_DEFINE_HASH(NAME<long long>)                                                                \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<long long>)                                                   \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<long long>)                                                  \
+		STRICT_TYPES_DEFINE_FORMATTER(NAME<unsigned long long>)                                                  \
+		STRICT_TYPES_DEFINE_HASH(NAME<unsigned long long>)                                                       \
+		STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME<unsigned long long>)                                          \
+		STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME<unsigned long long>)
 #endif
 
 // =============================================================================
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	interned.hpp description:
+		This header file contains interned strings: 32-bit ids into an append-only,
+		thread-safe string table, with one table per tag type.
+
+			struct metric_tag;
+			using metric_name = strict::interned<metric_tag>;
+
+			const metric_name requests {"http.requests"};   // Interned once.
+
+		Comparing and hashing interned strings compares and hashes their ids, and the
+		text is only looked up again by view() and the formatter. Interned strings
+		with different tags belong to different tables, and cannot be mixed.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Append-only, thread-safe table of the strings interned with [Tag].
+	///
+	//  Requirements:
+	//   - Strings are never removed, so the table only grows.
+	//   - Ids are assigned in insertion order, starting with the empty string at 0.
+	/// @tparam Tag The tag type of the table. May be incomplete.
+	template <typename Tag>
+	struct string_table {
+			using tag_type = Tag;
+			using id_type	= std::uint32_t;
+
+			/// @brief The largest number of strings a table can hold.
+			inline constexpr static std::size_t max_size = std::numeric_limits<id_type>::max();
+
+			string_table(const string_table&)				= delete;
+			string_table& operator=(const string_table&) = delete;
+
+			/// @brief Returns the table of [Tag], constructing it on the first call.
+			/// @returns string_table&
+			[[nodiscard]] inline static string_table& instance() {
+				static string_table table;
+				return table;
+			}
+
+			/// @brief Returns the id of [text], adding it to the table if it is not there yet.
+			/// @returns id_type
+			[[nodiscard]] inline id_type intern(const std::string_view text) {
+				{
+					const std::shared_lock lock(this->m_mutex);
+
+					if (const auto found = this->m_ids.find(text); found != this->m_ids.end()) return found->second;
+				}
+
+				const std::unique_lock lock(this->m_mutex);
+
+				// Another thread may have added [text] between the two locks.
+				if (const auto found = this->m_ids.find(text); found != this->m_ids.end()) return found->second;
+
+				return this->m_append(text);
+			}
+
+			/// @brief Interns every string of [texts], such as the known names at startup.
+			inline void intern(const std::initializer_list<std::string_view> texts) {
+				for (const std::string_view text : texts) static_cast<void>(this->intern(text));
+			}
+
+			/// @brief Returns the text of [id]. The view stays valid for the lifetime of the program.
+			/// @returns std::string_view
+			[[nodiscard]] inline std::string_view view(const id_type id) const {
+				const std::shared_lock lock(this->m_mutex);
+
+				STRICT_TYPES_ASSERT(id < this->m_strings.size(), "string_table: id out of range");
+				return this->m_strings[id];
+			}
+
+			/// @brief Returns the number of strings in the table.
+			/// @returns std::size_t
+			[[nodiscard]] inline std::size_t size() const {
+				const std::shared_lock lock(this->m_mutex);
+
+				return this->m_strings.size();
+			}
+
+			/// @brief Reserves room for [count] strings in the lookup index.
+			inline void reserve(const std::size_t count) {
+				const std::unique_lock lock(this->m_mutex);
+
+				this->m_ids.reserve(count);
+			}
+
+		protected:
+			inline string_table() { static_cast<void>(this->m_append({})); }
+
+			// The caller must hold the unique lock.
+			inline id_type m_append(const std::string_view text) {
+				STRICT_TYPES_ASSERT(this->m_strings.size() < max_size, "string_table: out of ids");
+
+				const auto id = static_cast<id_type>(this->m_strings.size());
+
+				// std::deque never relocates its elements when appending, so the keys of m_ids stay valid.
+				const std::string& stored = this->m_strings.emplace_back(text);
+
+				// Removes the string again if indexing it throws: a string without an index entry would
+				// be appended a second time by the next intern() of the same text, under another id.
+				struct append_guard {
+						std::deque<std::string>* strings = nullptr;
+
+						inline ~append_guard() noexcept {
+							if (this->strings != nullptr) this->strings->pop_back();
+						}
+				} guard {&this->m_strings};
+
+				this->m_ids.emplace(std::string_view(stored), id);
+				guard.strings = nullptr;
+
+				return id;
+			}
+
+			mutable std::shared_mutex						  m_mutex	= {};
+			std::deque<std::string>							  m_strings = {};
+			std::unordered_map<std::string_view, id_type> m_ids		= {};
+	};
+
+	/// @brief Interned string: a 32-bit id into the string table of [Tag].
+	///
+	//  Requirements:
+	//   - Comparisons are by id, which is equivalent to comparing the text within one table.
+	//   - Default-constructed interned strings are the empty string.
+	/// @tparam Tag The tag type of the string table. May be incomplete.
+	template <typename Tag>
+	struct interned {
+			using tag_type	 = Tag;
+			using table_type = STRICT_TYPES_NAMESPACE::string_table<Tag>;
+			using type		 = typename table_type::id_type;
+
+			type value = {};
+
+			/// @brief Default constructor, constructing the empty string.
+			inline constexpr interned() noexcept = default;
+
+			/// @brief Interns [text].
+			inline explicit interned(const std::string_view text) :
+				value(table_type::instance().intern(text)) { }
+
+			/// @brief Reconstructs an interned string from its [id], such as one stored by another structure.
+			/// @returns interned
+			[[nodiscard]] inline constexpr static interned from_id(const type id) noexcept {
+				interned result;
+				result.value = id;
+				return result;
+			}
+
+			/// @brief Returns the string table of [Tag].
+			/// @returns table_type&
+			[[nodiscard]] inline static table_type& table() { return table_type::instance(); }
+
+			/// @brief Returns the id.
+			/// @returns type
+			[[nodiscard]] inline constexpr type id() const noexcept { return this->value; }
+
+			/// @brief Returns the text, looked up in the string table.
+			/// @returns std::string_view
+			[[nodiscard]] inline std::string_view view() const { return table_type::instance().view(this->value); }
+
+			/// @brief Returns a copy of the text.
+			/// @returns std::string
+			[[nodiscard]] inline std::string to_string() const { return std::string(this->view()); }
+
+			/// @brief Returns true if this is the empty string.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool empty() const noexcept { return this->value == 0; }
+
+			[[nodiscard]] inline constexpr friend bool operator==(const interned& left, const interned& right) noexcept = default;
+	};
+}
+
+template <typename Tag>
+struct std::formatter<STRICT_TYPES_NAMESPACE::interned<Tag>, char> : std::formatter<std::string_view, char> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::interned<Tag> value, FormatContext& context) const {
+			return std::formatter<std::string_view, char>::format(value.view(), context);
+		}
+};
+
+template <typename Tag>
+struct std::hash<STRICT_TYPES_NAMESPACE::interned<Tag>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::interned<Tag> value) const noexcept {
+			return std::hash<typename STRICT_TYPES_NAMESPACE::interned<Tag>::type> {}(value.value);
+		}
+};
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
@@ -7,10 +7,24 @@
 
 		Defined macros:
 			STRICT_TYPES_NAMESPACE
+			STRICT_TYPES_STRICTNESS
+			STRICT_TYPES_ASSERT
+			STRICT_TYPES_ASSERT_CHECKED
+			STRICT_TYPES_ASSUME
 			STRICT_TYPES_DEFINE_FORMATTER
+			STRICT_TYPES_DEFINE_HASH
+			STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS
+			STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT
+			STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT
 			STRICT_TYPES_DEFINE_UNARY_INCR_DECR_OPERATORS
 			STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS
 			STRICT_TYPES_DEFINE_COMPARISON_OPERATORS
+			STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS
+			STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS
+			STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS
+			STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS
+			STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS
+			STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS
 */
 
 // STRICT_TYPES_NAMESPACE should already be defined by the build system.
@@ -20,17 +34,150 @@
 	#define STRICT_TYPES_NAMESPACE strict
 #endif
 
+// The strictness levels of the strict_types library, from least to most checked:
+//    STRICT_TYPES_STRICTNESS_RELEASE - no checks; every assertion compiles away.
+//    STRICT_TYPES_STRICTNESS_DEBUG   - library preconditions are assert()ed (default).
+//    STRICT_TYPES_STRICTNESS_CHECKED - library preconditions, narrowing conversions,
+//                                      division by zero and shift widths are checked,
+//                                      even when NDEBUG is defined.
+#define STRICT_TYPES_STRICTNESS_RELEASE 0
+#define STRICT_TYPES_STRICTNESS_DEBUG	 1
+#define STRICT_TYPES_STRICTNESS_CHECKED 2
+
+// STRICT_TYPES_STRICTNESS should already be defined by the build system.
+// Otherwise it will be defined here automatically as the debug level.
+#if !defined(STRICT_TYPES_STRICTNESS)
+	#define STRICT_TYPES_STRICTNESS STRICT_TYPES_STRICTNESS_DEBUG
+#endif
+
+// STRICT_TYPES_ASSERT checks a precondition of the strict_types library.
+// It may be defined before including any strict_types header to route
+// failures elsewhere. Otherwise it is defined here according to the
+// strictness level: nothing at the release level, an assert() at the
+// debug level, and an unconditional check calling std::abort() at the
+// checked level.
+#if !defined(STRICT_TYPES_ASSERT)
+	#if STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_CHECKED
+		#include <cstdio>
+		#include <cstdlib>
+
+		#define STRICT_TYPES_ASSERT(CONDITION, MESSAGE) (static_cast<bool>(CONDITION) ? static_cast<void>(0) : (std::fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, MESSAGE), std::abort()))
+	#elif STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_DEBUG
+		#include <cassert>
+
+		#define STRICT_TYPES_ASSERT(CONDITION, MESSAGE) assert((CONDITION) && (MESSAGE))
+	#else
+		#define STRICT_TYPES_ASSERT(CONDITION, MESSAGE) static_cast<void>(0)
+	#endif
+#endif
+
+// STRICT_TYPES_ASSERT_CHECKED is a STRICT_TYPES_ASSERT only enabled at the
+// checked strictness level, for checks on hot paths such as arithmetic
+// operators and conversions. Below the checked level neither [CONDITION]
+// nor [MESSAGE] is compiled, so the generated code is unchanged.
+#if STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_CHECKED
+	#define STRICT_TYPES_ASSERT_CHECKED(CONDITION, MESSAGE) STRICT_TYPES_ASSERT(CONDITION, MESSAGE)
+#else
+	#define STRICT_TYPES_ASSERT_CHECKED(CONDITION, MESSAGE) static_cast<void>(0)
+#endif
+
+// STRICT_TYPES_ASSUME tells the optimizer that [CONDITION] always holds, so
+// it can drop range checks, narrow divisions and shrink switch tables. It is
+// a statement, and [CONDITION] must not have side effects. At the checked
+// strictness level it is asserted instead of assumed.
+#if STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_CHECKED
+	#define STRICT_TYPES_ASSUME(CONDITION) STRICT_TYPES_ASSERT(CONDITION, "strict_types: assumption does not hold")
+#elif defined(__clang__)
+	#define STRICT_TYPES_ASSUME(CONDITION) __builtin_assume(CONDITION)
+#elif defined(_MSC_VER)
+	#define STRICT_TYPES_ASSUME(CONDITION) __assume(CONDITION)
+#elif __cplusplus > 202002L && __has_cpp_attribute(assume)
+	#define STRICT_TYPES_ASSUME(CONDITION) [[assume(CONDITION)]]
+#elif defined(__GNUC__)
+	#define STRICT_TYPES_ASSUME(CONDITION) ((CONDITION) ? static_cast<void>(0) : __builtin_unreachable())
+#else
+	#define STRICT_TYPES_ASSUME(CONDITION) static_cast<void>(0)
+#endif
+
 //	Defines a formatter for a strict_types integral or strict_types floating-point type.
 //	Used primarily by other strict_types macros.
-#define STRICT_TYPES_DEFINE_FORMATTER(TYPE)                                                                                                                                                             \
-	template <>                                                                                                                                                                                          \
-	struct _STD formatter<STRICT_TYPES_NAMESPACE::TYPE> {                                                                                                                                                \
-			[[nodiscard]] inline constexpr auto parse(const _STD format_parse_context& context) const noexcept { return context.begin(); }                                                                 \
-			[[nodiscard]] inline constexpr auto parse(const _STD wformat_parse_context& context) const noexcept { return context.begin(); }                                                                \
-			[[nodiscard]] inline auto				format(const STRICT_TYPES_NAMESPACE::TYPE value, _STD format_context& context) const { return _STD format_to(context.out(), "{}", value.to_string()); }    \
-			[[nodiscard]] inline auto				format(const STRICT_TYPES_NAMESPACE::TYPE value, _STD wformat_context& context) const { return _STD format_to(context.out(), L"{}", value.to_wstring()); } \
+//
+//	The formatter inherits the std::formatter of the encapsulated type, so every
+//	format-spec it supports ({:08x}, {:.3f}, {:>12}, etc.) is parsed once and the
+//	value is written straight into the output iterator. The encapsulated type is
+//	promoted with unary + so character types are formatted as numbers by default,
+//	the same as std::to_string() does.
+#define STRICT_TYPES_DEFINE_FORMATTER(TYPE)                                                                                                   \
+	template <typename CharType>                                                                                                               \
+	struct std::formatter<STRICT_TYPES_NAMESPACE::TYPE, CharType> : std::formatter<decltype(+STRICT_TYPES_NAMESPACE::TYPE::value), CharType> { \
+			template <typename FormatContext>                                                                                                    \
+			[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::TYPE value, FormatContext& context) const {                           \
+				return std::formatter<decltype(+STRICT_TYPES_NAMESPACE::TYPE::value), CharType>::format(+value.value, context);                   \
+			}                                                                                                                                    \
+	};
+
+//	Defines a std::hash specialization for a strict_types integral or strict_types floating-point type.
+//	Used primarily by other strict_types macros.
+//
+//	The value is hashed by the std::hash of the encapsulated type, so a strict key
+//	hashes the same as its raw value. See strict::mixing_hash for integral keys
+//	that need stronger bit mixing.
+#define STRICT_TYPES_DEFINE_HASH(TYPE)                                                                          \
+	template <>                                                                                                  \
+	struct std::hash<STRICT_TYPES_NAMESPACE::TYPE> {                                                             \
+			[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::TYPE value) const noexcept { \
+				return std::hash<decltype(STRICT_TYPES_NAMESPACE::TYPE::value)> {}(value.value);                    \
+			}                                                                                                      \
 	};
 
+//	Defines compile-time layout guarantees for a strict_types integral or strict_types floating-point type.
+//	Used primarily by other strict_types macros.
+//
+//	A strict type must be trivially copyable and standard-layout, with the same size and
+//	alignment as its encapsulated type. Arrays of strict values can then be reinterpreted
+//	as arrays of raw values, and std::copy, std::fill and std::vector reallocation can
+//	take the same memmove/memset fast paths as they do for the encapsulated type.
+#define STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(TYPE)                                                                                                                                      \
+	static_assert(std::is_trivially_copyable_v<STRICT_TYPES_NAMESPACE::TYPE>, "strict_types: " #TYPE " must be trivially copyable");                                                      \
+	static_assert(std::is_standard_layout_v<STRICT_TYPES_NAMESPACE::TYPE>, "strict_types: " #TYPE " must be standard-layout");                                                            \
+	static_assert(sizeof(STRICT_TYPES_NAMESPACE::TYPE) == sizeof(STRICT_TYPES_NAMESPACE::TYPE::type), "strict_types: " #TYPE " must have the same size as its encapsulated type");        \
+	static_assert(alignof(STRICT_TYPES_NAMESPACE::TYPE) == alignof(STRICT_TYPES_NAMESPACE::TYPE::type), "strict_types: " #TYPE " must have the same alignment as its encapsulated type");
+
+//	Defines the layout fingerprint of a strict_types type, from its structural fingerprint and [TYPE] as spelled.
+//	Used primarily by other strict_types macros.
+//
+//	Strict types of the same layout but different names get different fingerprints, so a
+//	mapped file of strict::meters_t is not accepted as an array of strict::seconds_t.
+//	Requires strict_types/fingerprint.hpp.
+#define STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(TYPE)                                                                                                                                                                             \
+	template <>                                                                                                                                                                                                                   \
+	struct STRICT_TYPES_NAMESPACE::layout_fingerprint<STRICT_TYPES_NAMESPACE::TYPE> : std::integral_constant<std::uint64_t, STRICT_TYPES_NAMESPACE::details::strict_layout_fingerprint<STRICT_TYPES_NAMESPACE::TYPE>(#TYPE)> { };
+
+//	Defines the layout fingerprint of the standard-layout aggregate [TYPE], from its name,
+//	size and alignment, and the fingerprint and offset of every member listed after [TYPE], which
+//	should list every non-static data member in declaration order (up to 256).
+//	Must be used at global namespace scope, with [TYPE] qualified by its namespace.
+//	Requires strict_types/fingerprint.hpp.
+//
+//	Usage example:
+//	   STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT(net::packet_header, type, flags, length)
+#define STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT(TYPE, ...)                                                                                                                                                                            \
+	template <>                                                                                                                                                                                                                          \
+	struct STRICT_TYPES_NAMESPACE::layout_fingerprint<TYPE> : std::integral_constant<std::uint64_t, STRICT_TYPES_NAMESPACE::details::aggregate_layout_fingerprint<TYPE>(#TYPE, { STRICT_TYPES_MEMBER_LAYOUTS(TYPE, __VA_ARGS__) })> { };
+
+// Expands to the comma-separated STRICT_TYPES_NAMESPACE::details::member_layout of every member listed after [TYPE].
+// Normally only used by STRICT_TYPES_DEFINE_AGGREGATE_FINGERPRINT.
+#define STRICT_TYPES_MEMBER_LAYOUT(TYPE, MEMBER) STRICT_TYPES_NAMESPACE::details::member_layout { STRICT_TYPES_NAMESPACE::layout_fingerprint_v<decltype(TYPE::MEMBER)>, offsetof(TYPE, MEMBER) }
+#define STRICT_TYPES_MEMBER_LAYOUTS(TYPE, ...) __VA_OPT__(STRICT_TYPES_EXPAND(STRICT_TYPES_MEMBER_LAYOUTS_NEXT(TYPE, __VA_ARGS__)))
+#define STRICT_TYPES_MEMBER_LAYOUTS_NEXT(TYPE, MEMBER, ...) STRICT_TYPES_MEMBER_LAYOUT(TYPE, MEMBER) __VA_OPT__(, STRICT_TYPES_MEMBER_LAYOUTS_AGAIN STRICT_TYPES_PARENS(TYPE, __VA_ARGS__))
+#define STRICT_TYPES_MEMBER_LAYOUTS_AGAIN() STRICT_TYPES_MEMBER_LAYOUTS_NEXT
+#define STRICT_TYPES_PARENS ()
+#define STRICT_TYPES_EXPAND(...) STRICT_TYPES_EXPAND_4(STRICT_TYPES_EXPAND_4(STRICT_TYPES_EXPAND_4(STRICT_TYPES_EXPAND_4(__VA_ARGS__))))
+#define STRICT_TYPES_EXPAND_4(...) STRICT_TYPES_EXPAND_3(STRICT_TYPES_EXPAND_3(STRICT_TYPES_EXPAND_3(STRICT_TYPES_EXPAND_3(__VA_ARGS__))))
+#define STRICT_TYPES_EXPAND_3(...) STRICT_TYPES_EXPAND_2(STRICT_TYPES_EXPAND_2(STRICT_TYPES_EXPAND_2(STRICT_TYPES_EXPAND_2(__VA_ARGS__))))
+#define STRICT_TYPES_EXPAND_2(...) STRICT_TYPES_EXPAND_1(STRICT_TYPES_EXPAND_1(STRICT_TYPES_EXPAND_1(STRICT_TYPES_EXPAND_1(__VA_ARGS__))))
+#define STRICT_TYPES_EXPAND_1(...) __VA_ARGS__
+
 // Defines unary and incremental/decremental operators.
 // Normally only used inside the integral.hpp or float.hpp header files.
 //
@@ -75,45 +222,53 @@
 	}
 
 // This macro defines a tri-collection of arithmetic operators specified by [OP].
+// At the checked strictness level, integral division by zero and out of range
+// shift widths are asserted.
 // Normally only used inside the integral.hpp or float.hpp header files.
 //
 // Usage example:
 //    STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(+, float)
 //    STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(/, float)
 //    STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(*, integral)
-#define STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(OP, STRICT_TYPE_CONCEPT)                                                                                  \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {            \
-		return static_cast<Left>(left.value OP right.value);                                                                                                 \
-	}                                                                                                                                                       \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator_left_only<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {  \
-		return static_cast<Left>(left.value OP right);                                                                                                       \
-	}                                                                                                                                                       \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator_right_only<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept { \
-		return static_cast<Left>(left OP right.value);                                                                                                       \
-	}                                                                                                                                                       \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                        \
-		left.value OP## = right.value;                                                                                                                       \
-		return left;                                                                                                                                         \
-	}                                                                                                                                                       \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator_left_only<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {              \
-		left.value OP## = right;                                                                                                                             \
-		return left;                                                                                                                                         \
-	}                                                                                                                                                       \
-	template <typename Left, typename Right>                                                                                                                \
-		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                              \
-	##STRICT_TYPE_CONCEPT##_operator_right_only<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {             \
-		left OP## = right.value;                                                                                                                             \
-		return left;                                                                                                                                         \
+#define STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(OP, STRICT_TYPE_CONCEPT)                                                                                            \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                      \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left.value, right.value), "strict_types: invalid right operand of " #OP); \
+		return static_cast<Left>(static_cast<typename Left::type>(left.value OP right.value));                                                                         \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator_left_only<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {            \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left.value, right), "strict_types: invalid right operand of " #OP);       \
+		return static_cast<Left>(static_cast<typename Left::type>(left.value OP right));                                                                               \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator_right_only<Left, Right> [[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {           \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left, right.value), "strict_types: invalid right operand of " #OP);       \
+		return static_cast<Left>(left OP right.value);                                                                                                                 \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                  \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left.value, right.value), "strict_types: invalid right operand of " #OP); \
+		left.value OP## = right.value;                                                                                                                                 \
+		return left;                                                                                                                                                   \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator_left_only<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                        \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left.value, right), "strict_types: invalid right operand of " #OP);       \
+		left.value OP## = right;                                                                                                                                       \
+		return left;                                                                                                                                                   \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                        \
+	##STRICT_TYPE_CONCEPT##_operator_right_only<Left, Right> inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                       \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left, right.value), "strict_types: invalid right operand of " #OP);       \
+		left OP## = right.value;                                                                                                                                       \
+		return left;                                                                                                                                                   \
 	}
 
 // Similar to STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS, this macro defines
@@ -140,3 +295,172 @@
 	##STRICT_TYPE_CONCEPT##_operator_right_only<Left, Right> [[nodiscard]] inline constexpr bool operator OP(const Left left, const Right right) noexcept { \
 		return left OP right.value;                                                                                                                          \
 	}
+
+// Similar to STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS, this macro defines the
+// arithmetic operators specified by [OP] for strict_overflow_type, where the
+// overflow policy of the left operand decides the result of an overflowing
+// [OPERATION]. The operators are more constrained than the generic integral
+// ones, so they take precedence whenever the left operand has a policy.
+// Normally only used inside the overflow.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(+, add)
+#define STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(OP, OPERATION)                                                                                         \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator<Left, Right>                                                                      \
+	[[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                                                                \
+		return static_cast<Left>(STRICT_TYPES_NAMESPACE::details::overflow_##OPERATION<typename Left::policy_type, typename Left::type>(left.value, right.value)); \
+	}                                                                                                                                                             \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator_left_only<Left, Right>                                                            \
+	[[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                                                                \
+		return static_cast<Left>(STRICT_TYPES_NAMESPACE::details::overflow_##OPERATION<typename Left::policy_type, typename Left::type>(left.value, right));       \
+	}                                                                                                                                                             \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator_floating_point<Left, Right>                                                       \
+	Left operator OP(const Left left, const Right right) = delete;                                                                                                \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator<Left, Right>                                                                      \
+	inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                                                            \
+		left.value = STRICT_TYPES_NAMESPACE::details::overflow_##OPERATION<typename Left::policy_type, typename Left::type>(left.value, right.value);              \
+		return left;                                                                                                                                               \
+	}                                                                                                                                                             \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator_left_only<Left, Right>                                                            \
+	inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                                                            \
+		left.value = STRICT_TYPES_NAMESPACE::details::overflow_##OPERATION<typename Left::policy_type, typename Left::type>(left.value, right);                    \
+		return left;                                                                                                                                               \
+	}                                                                                                                                                             \
+	template <typename Left, typename Right>                                                                                                                      \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_operator_floating_point<Left, Right>                                                       \
+	Left& operator OP## = (Left & left, const Right right) = delete;
+
+// Similar to STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS, this macro defines the
+// arithmetic operators specified by [OP] for strict_ranged, reading each
+// ranged operand through get() so the optimizer knows its range. The results
+// are converted back to the left operand before truncation, so out of range
+// results are caught at the checked strictness level.
+// Normally only used inside the ranged.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(/)
+#define STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(OP)                                                                                                          \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator<Left, Right>                                                                            \
+	[[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                                                                    \
+		const auto left_value  = STRICT_TYPES_NAMESPACE::details::ranged_value(left);                                                                                  \
+		const auto right_value = STRICT_TYPES_NAMESPACE::details::ranged_value(right);                                                                                 \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left_value, right_value), "strict_types: invalid right operand of " #OP); \
+		return STRICT_TYPES_NAMESPACE::details::ranged_result<Left>(left_value OP right_value);                                                                        \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_left_only<Left, Right>                                                                  \
+	[[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                                                                    \
+		const auto left_value = left.get();                                                                                                                            \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left_value, right), "strict_types: invalid right operand of " #OP);       \
+		return static_cast<Left>(left_value OP right);                                                                                                                 \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_right_only<Left, Right>                                                                 \
+	[[nodiscard]] inline constexpr Left operator OP(const Left left, const Right right) noexcept {                                                                    \
+		const auto right_value = right.get();                                                                                                                          \
+		STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::are_valid_operands(#OP, left, right_value), "strict_types: invalid right operand of " #OP);       \
+		return static_cast<Left>(left OP right_value);                                                                                                                 \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator<Left, Right>                                                                            \
+	inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                                                                \
+		left = left OP right;                                                                                                                                          \
+		return left;                                                                                                                                                   \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_left_only<Left, Right>                                                                  \
+	inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                                                                \
+		left = left OP right;                                                                                                                                          \
+		return left;                                                                                                                                                   \
+	}                                                                                                                                                                 \
+	template <typename Left, typename Right>                                                                                                                          \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_right_only<Left, Right>                                                                 \
+	inline constexpr Left& operator OP## = (Left & left, const Right right) noexcept {                                                                                \
+		left = left OP right;                                                                                                                                          \
+		return left;                                                                                                                                                   \
+	}
+
+// Similar to STRICT_TYPES_DEFINE_COMPARISON_OPERATORS, this macro defines the
+// comparison operators specified by [OP] for strict_ranged, reading each
+// ranged operand through get() so comparisons against values outside the
+// range fold away.
+// Normally only used inside the ranged.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(<)
+#define STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(OP)                                                               \
+	template <typename Left, typename Right>                                                                               \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator<Left, Right>                                 \
+	[[nodiscard]] inline constexpr bool operator OP(const Left left, const Right right) noexcept {                         \
+		return STRICT_TYPES_NAMESPACE::details::ranged_value(left) OP STRICT_TYPES_NAMESPACE::details::ranged_value(right); \
+	}                                                                                                                      \
+	template <typename Left, typename Right>                                                                               \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_left_only<Left, Right>                       \
+	[[nodiscard]] inline constexpr bool operator OP(const Left left, const Right right) noexcept {                         \
+		return left.get() OP right;                                                                                         \
+	}                                                                                                                      \
+	template <typename Left, typename Right>                                                                               \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_ranged_operator_right_only<Left, Right>                      \
+	[[nodiscard]] inline constexpr bool operator OP(const Left left, const Right right) noexcept {                         \
+		return left OP right.get();                                                                                         \
+	}
+
+// Similar to STRICT_TYPES_DEFINE_COMPARISON_OPERATORS, this macro defines
+// the comparison operators specified by [OP] for strict_simd packs. Every
+// lane is compared, producing a strict_simd_mask instead of a bool.
+// Normally only used inside the simd.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(<, integral_simd)
+//    STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(==, float_simd)
+#define STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(OP, STRICT_TYPE_CONCEPT)                                                                                                \
+	template <typename Left, typename Right>                                                                                                                                   \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                                 \
+	##STRICT_TYPE_CONCEPT##_operator<Left, Right> [[nodiscard]] inline constexpr typename Left::mask_type operator OP(const Left left, const Right right) noexcept {           \
+		return static_cast<typename Left::mask_type>(left.value OP right.value);                                                                                                \
+	}                                                                                                                                                                          \
+	template <typename Left, typename Right>                                                                                                                                   \
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_                                                                                                                 \
+	##STRICT_TYPE_CONCEPT##_operator_left_only<Left, Right> [[nodiscard]] inline constexpr typename Left::mask_type operator OP(const Left left, const Right right) noexcept { \
+		return static_cast<typename Left::mask_type>(left.value OP right);                                                                                                      \
+	}
+
+// Defines the lane-wise operator specified by [OP], and its compound assignment,
+// for the portable strict_simd storage used when the compiler has no vector
+// extensions. The right operand may be another storage or a single lane value.
+// Normally only used inside the simd.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(+)
+#define STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(OP)                                                                                                                                                     \
+	template <typename Type, std::size_t Width, typename Right>                                                                                                                                              \
+	[[nodiscard]] inline constexpr STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width> operator OP(const STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width>& left, const Right& right) noexcept { \
+		STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width> result = {};                                                                                                                                 \
+		for (std::size_t i = 0; i < Width; ++i) result[i] = static_cast<Type>(left[i] OP STRICT_TYPES_NAMESPACE::details::simd_lane(right, i));                                                               \
+		return result;                                                                                                                                                                                        \
+	}                                                                                                                                                                                                        \
+	template <typename Type, std::size_t Width, typename Right>                                                                                                                                              \
+	inline constexpr STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width>& operator OP## = (STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width> & left, const Right& right) noexcept {              \
+		return left = left OP right;                                                                                                                                                                          \
+	}
+
+// Defines the lane-wise comparison operator specified by [OP] for the portable
+// strict_simd storage. Like vector extensions, every lane of the result is
+// all ones (-1) when the comparison holds, and zero otherwise.
+// Normally only used inside the simd.hpp header file.
+//
+// Usage example:
+//    STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(<)
+#define STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(OP)                                                                                                                                                                                             \
+	template <typename Type, std::size_t Width, typename Right>                                                                                                                                                                                                 \
+	[[nodiscard]] inline constexpr STRICT_TYPES_NAMESPACE::details::simd_array<STRICT_TYPES_NAMESPACE::details::simd_mask_lane_t<Type>, Width> operator OP(const STRICT_TYPES_NAMESPACE::details::simd_array<Type, Width>& left, const Right& right) noexcept { \
+		STRICT_TYPES_NAMESPACE::details::simd_array<STRICT_TYPES_NAMESPACE::details::simd_mask_lane_t<Type>, Width> result = {};                                                                                                                                 \
+		for (std::size_t i = 0; i < Width; ++i) result[i] = static_cast<STRICT_TYPES_NAMESPACE::details::simd_mask_lane_t<Type>>((left[i] OP STRICT_TYPES_NAMESPACE::details::simd_lane(right, i)) ? -1 : 0);                                                    \
+		return result;                                                                                                                                                                                                                                           \
+	}
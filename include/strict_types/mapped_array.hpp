@@ -0,0 +1,313 @@
+#pragma once
+
+#include "strict_types/fingerprint.hpp"
+#include "strict_types/macros.hpp"
+#include "strict_types/serialize.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#else
+	#error "strict_types: mapped_array.hpp requires a POSIX system (mmap)"
+#endif
+
+/*
+	mapped_array.hpp description:
+		This header file contains mapped_array, a read-only array of strict values
+		memory-mapped from a file, and write_mapped_array(), which writes such a file:
+
+			strict::write_mapped_array("ids.strict", std::span<const strict::uint32_t>(ids));
+
+			strict::mapped_array<strict::uint32_t> mapped;
+
+			if (mapped.open("ids.strict") != strict::mapped_status::ok) { ... }
+
+			std::span<const strict::uint32_t> view = mapped;   // No parsing, no copy.
+
+		The file starts with a 128-byte header holding the element size, alignment, layout
+		fingerprint (see fingerprint.hpp), byte order and count, validated against the
+		element type when the file is opened. The elements follow, in the byte order of the host that wrote them.
+		Pages are read on first access; advise() forwards access pattern hints to madvise.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief The result of opening or writing a mapped array file.
+	enum class mapped_status : std::uint8_t {
+		ok,
+		open_failed,			// The file could not be opened or created.
+		map_failed,				// The file could not be memory-mapped.
+		write_failed,			// The file could not be written.
+		invalid_header,		// The file is not a mapped array file, or has another version.
+		type_mismatch,			// The file holds another element type (its layout fingerprint differs).
+		layout_mismatch,		// The element size or alignment differs.
+		byte_order_mismatch,	// The file was written by a host of the other byte order.
+		size_mismatch,			// The file size does not match the element count.
+	};
+
+	/// @brief Access pattern hints forwarded to madvise.
+	enum class mapped_advice : std::uint8_t {
+		normal,		// MADV_NORMAL
+		sequential,	// MADV_SEQUENTIAL: read ahead aggressively, and drop pages after they are read.
+		random,		// MADV_RANDOM: do not read ahead.
+		will_need,	// MADV_WILLNEED: start reading every page in the background.
+		dont_need,	// MADV_DONTNEED: release the pages, to be read again on the next access.
+	};
+
+	namespace details {
+		/// @brief The header of a mapped array file, serialized in little-endian byte order.
+		struct mapped_header {
+				inline constexpr static std::size_t	  size	 = 128;
+				inline constexpr static std::uint64_t magic	 = 0x5241544349525453; // "STRICTAR" as little-endian bytes.
+				inline constexpr static std::uint32_t version = 2;
+
+				std::uint64_t file_magic	 = 0;
+				std::uint32_t file_version	 = 0;
+				std::uint32_t element_size	 = 0;
+				std::uint32_t element_align = 0;
+				std::uint32_t big_endian	 = 0;
+				std::uint64_t count			 = 0;
+				std::uint64_t fingerprint	 = 0;
+
+				/// @brief Returns the header describing [count] elements of [Type], written by this host.
+				/// @returns mapped_header
+				template <typename Type>
+				[[nodiscard]] inline static mapped_header describe(const std::uint64_t count) noexcept {
+					mapped_header header;
+					header.file_magic		= magic;
+					header.file_version	= version;
+					header.element_size	= sizeof(Type);
+					header.element_align	= alignof(Type);
+					header.big_endian		= std::endian::native == std::endian::big;
+					header.count			= count;
+					header.fingerprint	= STRICT_TYPES_NAMESPACE::layout_fingerprint_v<Type>;
+
+					return header;
+				}
+
+				inline void write(const std::span<std::byte, size> output) const noexcept {
+					std::span<std::byte> rest = output;
+
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->file_magic, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->file_version, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->element_size, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->element_align, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->big_endian, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->count, rest);
+					rest = STRICT_TYPES_NAMESPACE::serialize(this->fingerprint, rest);
+
+					std::fill(rest.begin(), rest.end(), std::byte {0});
+				}
+
+				[[nodiscard]] inline static mapped_header read(const std::span<const std::byte, size> input) noexcept {
+					mapped_header header;
+					std::span<const std::byte> rest = input;
+
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.file_magic, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.file_version, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.element_size, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.element_align, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.big_endian, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.count, rest);
+					rest = STRICT_TYPES_NAMESPACE::deserialize(header.fingerprint, rest);
+
+					return header;
+				}
+
+				/// @brief Returns how [this] header, read from a file of [file_size] bytes, matches [expected].
+				/// @returns mapped_status
+				[[nodiscard]] inline mapped_status validate(const mapped_header& expected, const std::uint64_t file_size) const noexcept {
+					if (this->file_magic != magic || this->file_version != version) return mapped_status::invalid_header;
+					if (this->element_size != expected.element_size || this->element_align != expected.element_align) return mapped_status::layout_mismatch;
+					if (this->fingerprint != expected.fingerprint) return mapped_status::type_mismatch;
+					if (this->big_endian != expected.big_endian) return mapped_status::byte_order_mismatch;
+
+					// Compared by division, as count * element_size may overflow for a corrupt count.
+					const std::uint64_t data_size = file_size - size;
+					if (data_size % this->element_size != 0 || data_size / this->element_size != this->count) return mapped_status::size_mismatch;
+
+					return mapped_status::ok;
+				}
+		};
+
+		static_assert(sizeof(std::uint64_t) * 3 + sizeof(std::uint32_t) * 4 <= mapped_header::size, "the mapped array header fields must fit its size");
+	}
+
+	/// @brief Read-only array of [Type] memory-mapped from a file written by write_mapped_array().
+	///
+	//  Requirements:
+	//   - Type must be trivially copyable, with an alignment of at most 128 bytes (the header size).
+	//   - The file must not be modified while it is mapped.
+	/// @tparam Type The element type, such as a strict integral or strict float type.
+	template <typename Type>
+		requires std::is_trivially_copyable_v<Type> && (alignof(Type) <= STRICT_TYPES_NAMESPACE::details::mapped_header::size)
+	struct mapped_array {
+			using value_type		 = Type;
+			using size_type		 = std::size_t;
+			using const_reference = const Type&;
+			using const_pointer	 = const Type*;
+			using const_iterator	 = const Type*;
+
+			/// @brief Default constructor, mapping nothing.
+			inline constexpr mapped_array() noexcept = default;
+
+			mapped_array(const mapped_array&)				= delete;
+			mapped_array& operator=(const mapped_array&)	= delete;
+
+			/// @brief Move constructor.
+			inline mapped_array(mapped_array&& other) noexcept :
+				m_mapping(std::exchange(other.m_mapping, nullptr)), m_mapping_size(std::exchange(other.m_mapping_size, 0)), m_size(std::exchange(other.m_size, 0)) { }
+
+			/// @brief Move-assignment operator.
+			inline mapped_array& operator=(mapped_array&& other) noexcept {
+				if (this != &other) {
+					this->close();
+
+					this->m_mapping		= std::exchange(other.m_mapping, nullptr);
+					this->m_mapping_size	= std::exchange(other.m_mapping_size, 0);
+					this->m_size			= std::exchange(other.m_size, 0);
+				}
+
+				return *this;
+			}
+
+			inline ~mapped_array() { this->close(); }
+
+			/// @brief Maps the file at [path], replacing the current mapping, and validates its header against [Type].
+			/// @param advice The access pattern hint to give for the mapping.
+			/// @returns mapped_status mapped_status::ok on success; otherwise nothing is mapped.
+			[[nodiscard]] inline mapped_status open(const std::filesystem::path& path, const mapped_advice advice = mapped_advice::normal) noexcept {
+				using header_type = STRICT_TYPES_NAMESPACE::details::mapped_header;
+
+				this->close();
+
+				const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				if (file < 0) return mapped_status::open_failed;
+
+				struct stat status = {};
+				if (::fstat(file, &status) != 0 || static_cast<std::uint64_t>(status.st_size) < header_type::size) {
+					::close(file);
+					return mapped_status::invalid_header;
+				}
+
+				const auto	size	  = static_cast<std::size_t>(status.st_size);
+				void* const	mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+				// The mapping keeps its own reference to the file.
+				::close(file);
+
+				if (mapping == MAP_FAILED) return mapped_status::map_failed;
+
+				const auto header = header_type::read(std::span<const std::byte, header_type::size>(static_cast<const std::byte*>(mapping), header_type::size));
+				const mapped_status result = header.validate(header_type::describe<Type>(0), size);
+
+				if (result != mapped_status::ok) {
+					::munmap(mapping, size);
+					return result;
+				}
+
+				this->m_mapping		= mapping;
+				this->m_mapping_size	= size;
+				this->m_size			= static_cast<size_type>(header.count);
+
+				this->advise(advice);
+
+				return mapped_status::ok;
+			}
+
+			/// @brief Unmaps the file, if any.
+			inline void close() noexcept {
+				if (this->m_mapping != nullptr) ::munmap(this->m_mapping, this->m_mapping_size);
+
+				this->m_mapping		= nullptr;
+				this->m_mapping_size	= 0;
+				this->m_size			= 0;
+			}
+
+			/// @brief Gives the kernel an access pattern hint for the whole mapping.
+			/// @returns bool False if nothing is mapped, or madvise failed.
+			inline bool advise(const mapped_advice advice) noexcept {
+				if (this->m_mapping == nullptr) return false;
+
+				int flag = MADV_NORMAL;
+
+				switch (advice) {
+					case mapped_advice::normal		: flag = MADV_NORMAL; break;
+					case mapped_advice::sequential: flag = MADV_SEQUENTIAL; break;
+					case mapped_advice::random		: flag = MADV_RANDOM; break;
+					case mapped_advice::will_need	: flag = MADV_WILLNEED; break;
+					case mapped_advice::dont_need	: flag = MADV_DONTNEED; break;
+				}
+
+				return ::madvise(this->m_mapping, this->m_mapping_size, flag) == 0;
+			}
+
+			[[nodiscard]] inline bool is_open() const noexcept { return this->m_mapping != nullptr; }
+			[[nodiscard]] inline size_type size() const noexcept { return this->m_size; }
+			[[nodiscard]] inline bool empty() const noexcept { return this->m_size == 0; }
+
+			[[nodiscard]] inline const Type* data() const noexcept {
+				if (this->m_mapping == nullptr) return nullptr;
+
+				// The elements follow the header, which is aligned for every supported [Type].
+				return reinterpret_cast<const Type*>(static_cast<const std::byte*>(this->m_mapping) + STRICT_TYPES_NAMESPACE::details::mapped_header::size);
+			}
+
+			[[nodiscard]] inline const_iterator begin() const noexcept { return this->data(); }
+			[[nodiscard]] inline const_iterator end() const noexcept { return this->data() + this->m_size; }
+
+			/// @brief Subscript operator. [index] is checked by STRICT_TYPES_ASSERT.
+			/// @returns const Type&
+			[[nodiscard]] inline const Type& operator[](const size_type index) const noexcept {
+				STRICT_TYPES_ASSERT(index < this->m_size, "mapped_array: index out of range");
+				return this->data()[index];
+			}
+
+			/// @brief Returns the mapped elements.
+			/// @returns std::span<const Type>
+			[[nodiscard]] inline std::span<const Type> span() const noexcept { return {this->data(), this->m_size}; }
+
+			/// @brief Implicit conversion operator, returning the mapped elements.
+			/// @returns std::span<const Type>
+			[[nodiscard]] inline operator std::span<const Type>() const noexcept { return this->span(); }
+
+		protected:
+			void*			m_mapping		= nullptr;
+			std::size_t	m_mapping_size	= 0;
+			size_type	m_size			= 0;
+	};
+
+	/// @brief Writes [values] to the file at [path], replacing it, to be opened by mapped_array<Type>.
+	/// @returns mapped_status
+	template <typename Type>
+		requires std::is_trivially_copyable_v<Type> && (alignof(Type) <= STRICT_TYPES_NAMESPACE::details::mapped_header::size)
+	[[nodiscard]] inline mapped_status write_mapped_array(const std::filesystem::path& path, const std::span<const Type> values) noexcept {
+		using header_type = STRICT_TYPES_NAMESPACE::details::mapped_header;
+
+		std::array<std::byte, header_type::size> header;
+		header_type::describe<Type>(values.size()).write(header);
+
+		std::FILE* const file = std::fopen(path.c_str(), "wb");
+		if (file == nullptr) return mapped_status::open_failed;
+
+		bool written = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+		if (written && !values.empty()) written = std::fwrite(values.data(), sizeof(Type), values.size(), file) == values.size();
+
+		// Closing flushes the buffered writes, which may fail too.
+		if (std::fclose(file) != 0) written = false;
+
+		return written ? mapped_status::ok : mapped_status::write_failed;
+	}
+}
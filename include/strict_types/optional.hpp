@@ -0,0 +1,147 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	optional.hpp description:
+		This header file contains an optional strict integral or strict float value
+		that reserves one value of the type, the sentinel, as "no value":
+
+			strict::optional<strict::index_t>        - empty is index_t::max.
+			strict::optional<strict::double_t>       - empty is a quiet NaN.
+			strict::optional<strict::int_t, -1>      - empty is -1.
+
+		Unlike std::optional, it has no separate flag, so it is exactly the size of the
+		encapsulated type and trivially copyable, and has_value() is a single compare.
+		Arrays of optional values therefore cost the same memory as arrays of values.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The default sentinel of strict::optional: quiet NaN for strict float types, max otherwise.
+		template <typename Type>
+		inline constexpr typename Type::type optional_sentinel = Type::max;
+
+		template <typename Type>
+			requires is_strict_float_type<Type>
+		inline constexpr typename Type::type optional_sentinel<Type> = Type::quiet_NaN;
+	}
+
+	/// @brief Optional strict integral or strict float value, using [Sentinel] as the empty state.
+	///
+	//  Requirements:
+	//   - [Sentinel] cannot be stored as a value.
+	//   - When [Sentinel] is NaN, every NaN is the empty state.
+	/// @tparam Type The strict integral or strict float type.
+	/// @tparam Sentinel The reserved value representing the empty state.
+	template <typename Type, typename Type::type Sentinel = STRICT_TYPES_NAMESPACE::details::optional_sentinel<Type>>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Type> || STRICT_TYPES_NAMESPACE::details::is_strict_float_type<Type>
+	struct optional {
+			using value_type = Type;
+
+			/// @brief Returns true if [Sentinel] is NaN, in which case emptiness is tested with a self-compare.
+			inline constexpr static bool nan_sentinel = Sentinel != Sentinel;
+
+			/// @brief Default constructor, constructing an empty optional.
+			inline constexpr optional() noexcept = default;
+
+			/// @brief Empty constructor.
+			inline constexpr optional(std::nullopt_t) noexcept { }
+
+			/// @brief Value constructor.
+			/// @param value The value, which must not be the sentinel.
+			inline constexpr optional(const Type value) noexcept :
+				m_value(value) {
+				STRICT_TYPES_ASSERT(this->has_value(), "optional: the sentinel value cannot be stored");
+			}
+
+			/// @brief Returns true if a value is stored.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool has_value() const noexcept {
+				if constexpr (nan_sentinel) return this->m_value.value == this->m_value.value;
+				else return this->m_value.value != Sentinel;
+			}
+
+			/// @brief Returns true if a value is stored.
+			/// @returns bool
+			[[nodiscard]] inline constexpr explicit operator bool() const noexcept { return this->has_value(); }
+
+			/// @brief Returns the stored value.
+			///
+			//  Requirements:
+			//   - A value must be stored.
+			/// @returns const Type&
+			[[nodiscard]] inline constexpr const Type& value() const noexcept {
+				STRICT_TYPES_ASSERT(this->has_value(), "optional: accessing the value of an empty optional");
+				return this->m_value;
+			}
+
+			/// @brief Returns the stored value, or [fallback] if empty.
+			/// @returns Type
+			[[nodiscard]] inline constexpr Type value_or(const Type fallback) const noexcept { return this->has_value() ? this->m_value : fallback; }
+
+			/// @brief Returns the stored value.
+			/// @returns const Type&
+			[[nodiscard]] inline constexpr const Type& operator*() const noexcept { return this->value(); }
+
+			/// @brief Returns a pointer to the stored value.
+			/// @returns const Type*
+			[[nodiscard]] inline constexpr const Type* operator->() const noexcept { return &this->value(); }
+
+			/// @brief Stores [value], which must not be the sentinel.
+			/// @returns Type&
+			inline constexpr Type& emplace(const Type value) noexcept {
+				*this = optional(value);
+				return this->m_value;
+			}
+
+			/// @brief Destroys the stored value, if any.
+			inline constexpr void reset() noexcept { this->m_value.value = Sentinel; }
+
+			/// @brief Returns true if both are empty, or both store equal values.
+			/// @returns bool
+			[[nodiscard]] inline constexpr friend bool operator==(const optional left, const optional right) noexcept {
+				if (left.has_value() != right.has_value()) return false;
+
+				return !left.has_value() || left.m_value.value == right.m_value.value;
+			}
+
+			/// @brief Returns true if [left] is empty.
+			/// @returns bool
+			[[nodiscard]] inline constexpr friend bool operator==(const optional left, std::nullopt_t) noexcept { return !left.has_value(); }
+
+			/// @brief Returns true if [left] stores a value equal to [right].
+			/// @returns bool
+			[[nodiscard]] inline constexpr friend bool operator==(const optional left, const Type right) noexcept {
+				return left.has_value() && left.m_value.value == right.value;
+			}
+
+		protected:
+			Type m_value = Type(Sentinel);
+	};
+}
+
+template <typename Type, typename Type::type Sentinel>
+struct std::hash<STRICT_TYPES_NAMESPACE::optional<Type, Sentinel>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::optional<Type, Sentinel> value) const noexcept {
+			return value.has_value() ? std::hash<typename Type::type> {}(value->value) : 0;
+		}
+};
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
@@ -0,0 +1,387 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define STRICT_TYPES_OVERFLOW_BUILTINS
+#endif
+
+/*
+	overflow.hpp description:
+		This header file contains strict integral types parameterized by an overflow policy,
+		and the wrapping, saturating and checked policies:
+
+			strict::wrapping<std::int16_t>    - overflowing results wrap around (two's complement).
+			strict::saturating<std::int16_t>  - overflowing results clamp to min or max.
+			strict::checked<std::uint32_t>    - overflowing results call std::terminate().
+
+		The generic integral operators compute in the promoted type and truncate back,
+		which silently wraps int8_t/int16_t results. Here, +, -, * and / compute the exact
+		result in a wider type when one exists, or detect overflow with __builtin_*_overflow
+		(or a portable fallback) otherwise. The policy of the left operand picks the result
+		with a select instead of a branch, so saturating loops still vectorize.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Overflow policy wrapping overflowing results around, as unsigned arithmetic does.
+	struct wrapping_policy {
+			template <typename Type>
+			[[nodiscard]] inline constexpr static Type resolve(const bool, const Type wrapped, const Type) noexcept { return wrapped; }
+	};
+
+	/// @brief Overflow policy clamping overflowing results to the minimum or maximum of the type.
+	struct saturating_policy {
+			template <typename Type>
+			[[nodiscard]] inline constexpr static Type resolve(const bool overflow, const Type wrapped, const Type saturated) noexcept {
+				return overflow ? saturated : wrapped;
+			}
+	};
+
+	/// @brief Overflow policy terminating the program on overflowing results.
+	struct checked_policy {
+			template <typename Type>
+			[[nodiscard]] inline constexpr static Type resolve(const bool overflow, const Type wrapped, const Type) noexcept {
+				if (overflow) [[unlikely]] std::terminate();
+
+				return wrapped;
+			}
+	};
+
+	namespace details {
+		/// @brief Returns true if [value] is negative, without comparing unsigned values against zero.
+		/// @returns bool
+		template <typename Type>
+		[[nodiscard]] inline constexpr bool is_negative(const Type value) noexcept {
+			if constexpr (std::is_signed_v<Type>) return value < 0;
+			else return false;
+		}
+
+		/// @brief Sign and magnitude of an exact intermediate result, for operations without a builtin or wider type.
+		struct overflow_value {
+				bool			  negative	= false;
+				std::uint64_t magnitude	= 0;
+				bool			  overflow	= false;
+		};
+
+		template <typename Type>
+		[[nodiscard]] inline constexpr overflow_value to_overflow_value(const Type value) noexcept {
+			if (is_negative(value)) return {true, std::uint64_t {0} - static_cast<std::uint64_t>(value), false};
+
+			return {false, static_cast<std::uint64_t>(value), false};
+		}
+
+		[[nodiscard]] inline constexpr overflow_value add_overflow_values(const overflow_value left, const overflow_value right) noexcept {
+			if (left.negative == right.negative) {
+				const std::uint64_t magnitude = left.magnitude + right.magnitude;
+				return {left.negative && magnitude != 0, magnitude, magnitude < left.magnitude};
+			}
+
+			if (left.magnitude >= right.magnitude) return {left.negative && left.magnitude != right.magnitude, left.magnitude - right.magnitude, false};
+
+			return {right.negative, right.magnitude - left.magnitude, false};
+		}
+
+		/// @brief Stores the result of [operation] wrapped into [Result], and returns true if it does not fit.
+		template <typename Result>
+		[[nodiscard]] inline constexpr bool store_overflow_value(const overflow_value value, Result& result) noexcept {
+			result = static_cast<Result>(value.negative ? std::uint64_t {0} - value.magnitude : value.magnitude);
+
+			if (value.overflow) return true;
+			if (!value.negative) return value.magnitude > static_cast<std::uint64_t>(std::numeric_limits<Result>::max());
+			if constexpr (std::is_unsigned_v<Result>) return true;
+			else return value.magnitude > static_cast<std::uint64_t>(std::numeric_limits<Result>::max()) + 1;
+		}
+
+		/// @brief Stores [left] + [right] wrapped into [result], and returns true if the exact sum does not fit.
+		template <typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr bool add_overflow(const Left left, const Right right, Result& result) noexcept {
+#if defined(STRICT_TYPES_OVERFLOW_BUILTINS)
+			return __builtin_add_overflow(left, right, &result);
+#else
+			return store_overflow_value(add_overflow_values(to_overflow_value(left), to_overflow_value(right)), result);
+#endif
+		}
+
+		/// @brief Stores [left] - [right] wrapped into [result], and returns true if the exact difference does not fit.
+		template <typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr bool sub_overflow(const Left left, const Right right, Result& result) noexcept {
+#if defined(STRICT_TYPES_OVERFLOW_BUILTINS)
+			return __builtin_sub_overflow(left, right, &result);
+#else
+			overflow_value negated = to_overflow_value(right);
+			negated.negative		  = !negated.negative && negated.magnitude != 0;
+
+			return store_overflow_value(add_overflow_values(to_overflow_value(left), negated), result);
+#endif
+		}
+
+		/// @brief Stores [left] * [right] wrapped into [result], and returns true if the exact product does not fit.
+		template <typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr bool mul_overflow(const Left left, const Right right, Result& result) noexcept {
+#if defined(STRICT_TYPES_OVERFLOW_BUILTINS)
+			return __builtin_mul_overflow(left, right, &result);
+#else
+			const overflow_value	l			 = to_overflow_value(left);
+			const overflow_value	r			 = to_overflow_value(right);
+			const std::uint64_t	magnitude = l.magnitude * r.magnitude;
+
+			return store_overflow_value({(l.negative != r.negative) && magnitude != 0, magnitude, l.magnitude != 0 && magnitude / l.magnitude != r.magnitude}, result);
+#endif
+		}
+
+		/// @brief Signed type holding every exact result with [Digits] value bits, or void if there is none.
+		template <int Digits>
+		using overflow_wide_t = std::conditional_t<(Digits <= std::numeric_limits<std::int32_t>::digits),
+																 std::int32_t,
+																 std::conditional_t<(Digits <= std::numeric_limits<std::int64_t>::digits), std::int64_t, void>>;
+
+		/// @brief Returns the [exact] result of an operation as [Result], resolved by [Policy] if it does not fit.
+		///
+		//  Plain compares and a select, which vectorize, unlike the overflow builtins.
+		/// @returns Result
+		template <typename Policy, typename Result, typename Wide>
+		[[nodiscard]] inline constexpr Result overflow_resolve(const Wide exact) noexcept {
+			// [Wide] holds every value of [Result], so the limits convert exactly.
+			const bool below = exact < static_cast<Wide>(std::numeric_limits<Result>::min());
+			const bool above = exact > static_cast<Wide>(std::numeric_limits<Result>::max());
+
+			return Policy::resolve(below || above, static_cast<Result>(exact), below ? std::numeric_limits<Result>::min() : std::numeric_limits<Result>::max());
+		}
+
+		/// @brief Returns [left] + [right], resolved by [Policy] on overflow.
+		/// @returns Result
+		template <typename Policy, typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr Result overflow_add(const Left left, const Right right) noexcept {
+			using wide_type = overflow_wide_t<std::max(std::numeric_limits<Left>::digits, std::numeric_limits<Right>::digits) + 1>;
+
+			if constexpr (!std::is_void_v<wide_type>) {
+				return STRICT_TYPES_NAMESPACE::details::overflow_resolve<Policy, Result>(static_cast<wide_type>(static_cast<wide_type>(left) + static_cast<wide_type>(right)));
+			}
+			else {
+				Result		 wrapped	  = {};
+				const bool	 overflow  = STRICT_TYPES_NAMESPACE::details::add_overflow(left, right, wrapped);
+				const Result saturated = is_negative(right) ? std::numeric_limits<Result>::min() : std::numeric_limits<Result>::max();
+
+				return Policy::resolve(overflow, wrapped, saturated);
+			}
+		}
+
+		/// @brief Returns [left] - [right], resolved by [Policy] on overflow.
+		/// @returns Result
+		template <typename Policy, typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr Result overflow_sub(const Left left, const Right right) noexcept {
+			using wide_type = overflow_wide_t<std::max(std::numeric_limits<Left>::digits, std::numeric_limits<Right>::digits) + 1>;
+
+			if constexpr (!std::is_void_v<wide_type>) {
+				return STRICT_TYPES_NAMESPACE::details::overflow_resolve<Policy, Result>(static_cast<wide_type>(static_cast<wide_type>(left) - static_cast<wide_type>(right)));
+			}
+			else {
+				Result		 wrapped	  = {};
+				const bool	 overflow  = STRICT_TYPES_NAMESPACE::details::sub_overflow(left, right, wrapped);
+				const Result saturated = is_negative(right) ? std::numeric_limits<Result>::max() : std::numeric_limits<Result>::min();
+
+				return Policy::resolve(overflow, wrapped, saturated);
+			}
+		}
+
+		/// @brief Returns [left] * [right], resolved by [Policy] on overflow.
+		/// @returns Result
+		template <typename Policy, typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr Result overflow_mul(const Left left, const Right right) noexcept {
+			using wide_type = overflow_wide_t<std::numeric_limits<Left>::digits + std::numeric_limits<Right>::digits>;
+
+			if constexpr (!std::is_void_v<wide_type>) {
+				return STRICT_TYPES_NAMESPACE::details::overflow_resolve<Policy, Result>(static_cast<wide_type>(static_cast<wide_type>(left) * static_cast<wide_type>(right)));
+			}
+			else {
+				Result		 wrapped	  = {};
+				const bool	 overflow  = STRICT_TYPES_NAMESPACE::details::mul_overflow(left, right, wrapped);
+				const Result saturated = (is_negative(left) != is_negative(right)) ? std::numeric_limits<Result>::min() : std::numeric_limits<Result>::max();
+
+				return Policy::resolve(overflow, wrapped, saturated);
+			}
+		}
+
+		/// @brief Returns [left] / [right], resolved by [Policy] on overflow. Division by zero is not an overflow.
+		/// @returns Result
+		template <typename Policy, typename Result, typename Left, typename Right>
+		[[nodiscard]] inline constexpr Result overflow_div(const Left left, const Right right) noexcept {
+			STRICT_TYPES_ASSERT_CHECKED(right != 0, "strict_types: invalid right operand of /");
+
+			using wide_type = overflow_wide_t<std::max(std::numeric_limits<Left>::digits, std::numeric_limits<Right>::digits) + 1>;
+
+			if constexpr (!std::is_void_v<wide_type>) {
+				return STRICT_TYPES_NAMESPACE::details::overflow_resolve<Policy, Result>(static_cast<wide_type>(static_cast<wide_type>(left) / static_cast<wide_type>(right)));
+			}
+			else {
+				// Divides the magnitudes, so mixed signedness does not go through the usual arithmetic conversions.
+				const overflow_value	l			 = to_overflow_value(left);
+				const overflow_value	r			 = to_overflow_value(right);
+				const std::uint64_t	magnitude = l.magnitude / r.magnitude;
+				Result					wrapped	 = {};
+				const bool				overflow	 = store_overflow_value({(l.negative != r.negative) && magnitude != 0, magnitude, false}, wrapped);
+				const Result			saturated = (l.negative != r.negative) ? std::numeric_limits<Result>::min() : std::numeric_limits<Result>::max();
+
+				return Policy::resolve(overflow, wrapped, saturated);
+			}
+		}
+	}
+
+	/// @brief Strictly-typed integral-only encapsulation struct with an overflow policy.
+	///
+	//  Requirements:
+	//   - Policy must provide a static resolve(bool overflow, Type wrapped, Type saturated).
+	//   - Arithmetic with floating-point operands does not compile.
+	/// @tparam Type The encapsulated integral type.
+	/// @tparam Policy The overflow policy, such as strict::saturating_policy.
+	/// @tparam Strict The strict integral type the type was made from, or [Type]. Keeps saturating<meters_t> and saturating<seconds_t> distinct.
+	template <typename Type, typename Policy, typename Strict = Type>
+		requires std::is_integral_v<Type> && (!std::is_same_v<Type, bool>)
+	struct strict_overflow_type : STRICT_TYPES_NAMESPACE::strict_integral_type<Type> {
+			using policy_type = Policy;
+			using strict_type = Strict;
+
+			using STRICT_TYPES_NAMESPACE::strict_integral_type<Type>::strict_integral_type;
+
+			/// @brief Implicit constructor from the strict type it was made from.
+			/// @param other The strict value.
+			inline constexpr strict_overflow_type(const Strict other) noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict>
+				: STRICT_TYPES_NAMESPACE::strict_integral_type<Type>(other.value) { }
+
+			/// @brief Implicit conversion operator, returning the value as the strict type it was made from.
+			/// @returns Strict
+			[[nodiscard]] inline constexpr operator Strict() const noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict> {
+				return static_cast<Strict>(this->value);
+			}
+	};
+
+	namespace details {
+		/// @brief The encapsulated type of [Type] if it is a strict integral type, [Type] otherwise.
+		template <typename Type>
+		struct overflow_underlying {
+				using type = Type;
+		};
+
+		template <typename Type>
+			requires is_strict_integral_type<Type>
+		struct overflow_underlying<Type> {
+				using type = typename Type::type;
+		};
+
+		// Returns true if [Type] is a strict_overflow_type.
+		template <typename Type>
+		concept is_strict_overflow_type = requires { typename Type::policy_type; typename Type::strict_type; } && std::is_same_v<Type, STRICT_TYPES_NAMESPACE::strict_overflow_type<typename Type::type, typename Type::policy_type, typename Type::strict_type>>;
+
+		// Returns true if [Left] is a strict_overflow_type and [Right] is a strict integral type.
+		template <typename Left, typename Right>
+		concept is_qualified_overflow_operator = is_qualified_integral_operator<Left, Right> && is_strict_overflow_type<Left>;
+
+		// Returns true if [Left] is a strict_overflow_type and [Right] is an integral type.
+		template <typename Left, typename Right>
+		concept is_qualified_overflow_operator_left_only = is_qualified_integral_operator_left_only<Left, Right> && is_strict_overflow_type<Left> && std::is_integral_v<Right>;
+
+		// Returns true if [Left] is a strict_overflow_type and [Right] is a floating-point type.
+		template <typename Left, typename Right>
+		concept is_qualified_overflow_operator_floating_point = is_qualified_integral_operator_left_only<Left, Right> && is_strict_overflow_type<Left> && std::is_floating_point_v<Right>;
+
+		// Returns true if [Type] is a strict_overflow_type.
+		template <typename Type>
+		concept is_qualified_overflow_unary_operator = is_qualified_integral_operator<Type> && is_strict_overflow_type<Type>;
+	}
+
+	/// @brief Integral type whose overflowing results wrap around.
+	/// @tparam Type The integral or strict integral type.
+	template <typename Type>
+	using wrapping = STRICT_TYPES_NAMESPACE::strict_overflow_type<typename STRICT_TYPES_NAMESPACE::details::overflow_underlying<Type>::type, STRICT_TYPES_NAMESPACE::wrapping_policy, Type>;
+
+	/// @brief Integral type whose overflowing results clamp to its minimum or maximum.
+	/// @tparam Type The integral or strict integral type.
+	template <typename Type>
+	using saturating = STRICT_TYPES_NAMESPACE::strict_overflow_type<typename STRICT_TYPES_NAMESPACE::details::overflow_underlying<Type>::type, STRICT_TYPES_NAMESPACE::saturating_policy, Type>;
+
+	/// @brief Integral type whose overflowing results terminate the program.
+	/// @tparam Type The integral or strict integral type.
+	template <typename Type>
+	using checked = STRICT_TYPES_NAMESPACE::strict_overflow_type<typename STRICT_TYPES_NAMESPACE::details::overflow_underlying<Type>::type, STRICT_TYPES_NAMESPACE::checked_policy, Type>;
+
+	// ==========================================================================
+	// Operators
+	// ==========================================================================
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_unary_operator<Type>
+	inline constexpr Type& operator++(Type& value) noexcept {
+		value.value = STRICT_TYPES_NAMESPACE::details::overflow_add<typename Type::policy_type, typename Type::type>(value.value, 1);
+		return value;
+	}
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_unary_operator<Type>
+	inline constexpr Type operator++(Type& value, auto) noexcept {
+		const Type previous = value;
+		++value;
+		return previous;
+	}
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_unary_operator<Type>
+	inline constexpr Type& operator--(Type& value) noexcept {
+		value.value = STRICT_TYPES_NAMESPACE::details::overflow_sub<typename Type::policy_type, typename Type::type>(value.value, 1);
+		return value;
+	}
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_unary_operator<Type>
+	inline constexpr Type operator--(Type& value, auto) noexcept {
+		const Type previous = value;
+		--value;
+		return previous;
+	}
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_qualified_overflow_unary_operator<Type>
+	[[nodiscard]] inline constexpr Type operator-(const Type value) noexcept {
+		return static_cast<Type>(STRICT_TYPES_NAMESPACE::details::overflow_sub<typename Type::policy_type, typename Type::type>(typename Type::type {0}, value.value));
+	}
+
+	STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(+, add)
+	STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(-, sub)
+	STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(*, mul)
+	STRICT_TYPES_DEFINE_OVERFLOW_ARITHMETIC_OPERATORS(/, div)
+}
+
+template <typename Type, typename Policy, typename Strict, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::strict_overflow_type<Type, Policy, Strict>, CharType> : std::formatter<decltype(+Type {}), CharType> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::strict_overflow_type<Type, Policy, Strict> value, FormatContext& context) const {
+			return std::formatter<decltype(+Type {}), CharType>::format(+value.value, context);
+		}
+};
+
+template <typename Type, typename Policy, typename Strict>
+struct std::hash<STRICT_TYPES_NAMESPACE::strict_overflow_type<Type, Policy, Strict>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::strict_overflow_type<Type, Policy, Strict> value) const noexcept {
+			return std::hash<Type> {}(value.value);
+		}
+};
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
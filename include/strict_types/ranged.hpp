@@ -0,0 +1,235 @@
+#pragma once
+
+#include "strict_types/checks.hpp"
+#include "strict_types/concepts.hpp"
+#include "strict_types/fingerprint.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	ranged.hpp description:
+		This header file contains a strict integral type bounded by a compile-time range,
+		stored in the smallest integral type holding every value of the range:
+
+			strict::strict_ranged<int, 0, 1023>  - stored as std::uint16_t.
+			strict::strict_ranged<int, -1, 255>  - stored as std::int16_t.
+
+		Construction is validated at the checked strictness level. Reading the value through
+		get(), the conversion operators or the operators of this header tells the optimizer
+		the range with STRICT_TYPES_ASSUME, so divisions, comparisons and switches over
+		ranged values can be lowered for the range instead of the whole storage type.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The smallest standard integral type holding every value in [Min, Max].
+		/// @tparam Type The type of the bounds.
+		template <typename Type, Type Min, Type Max>
+		struct ranged_storage {
+			private:
+				template <typename Storage>
+				inline constexpr static bool fits = STRICT_TYPES_NAMESPACE::details::is_in_range<Storage>(Min) && STRICT_TYPES_NAMESPACE::details::is_in_range<Storage>(Max);
+
+				// Unsigned storage for non-negative ranges, signed storage otherwise.
+				template <typename Unsigned, typename Signed>
+				using pick = std::conditional_t<(Min >= 0), Unsigned, Signed>;
+
+				using storage_8	 = pick<std::uint8_t, std::int8_t>;
+				using storage_16 = pick<std::uint16_t, std::int16_t>;
+				using storage_32 = pick<std::uint32_t, std::int32_t>;
+				using storage_64 = pick<std::uint64_t, std::int64_t>;
+
+			public:
+				using type = std::conditional_t<fits<storage_8>,
+														  storage_8,
+														  std::conditional_t<fits<storage_16>, storage_16, std::conditional_t<fits<storage_32>, storage_32, storage_64>>>;
+		};
+
+		template <typename Type, Type Min, Type Max>
+		using ranged_storage_t = typename ranged_storage<Type, Min, Max>::type;
+	}
+
+	/// @brief Strictly-typed integral-only encapsulation struct bounded by [Min, Max].
+	///
+	//  Requirements:
+	//   - Min <= Max.
+	//   - Values outside [Min, Max] are undefined behavior at the release and debug
+	//     strictness levels, and assertion failures at the checked level.
+	/// @tparam Type The integral type of the bounds.
+	/// @tparam Min The smallest value in the range.
+	/// @tparam Max The largest value in the range.
+	template <typename Type, Type Min, Type Max>
+		requires std::is_integral_v<Type> && (!std::is_same_v<Type, bool>) && (Min <= Max)
+	struct strict_ranged : STRICT_TYPES_NAMESPACE::strict_integral_type<STRICT_TYPES_NAMESPACE::details::ranged_storage_t<Type, Min, Max>> {
+			using type = STRICT_TYPES_NAMESPACE::details::ranged_storage_t<Type, Min, Max>;
+
+			inline constexpr static type min = static_cast<type>(Min);
+			inline constexpr static type max = static_cast<type>(Max);
+
+			/// @brief Default constructor, initializing to the value in range closest to zero.
+			inline constexpr strict_ranged() noexcept { this->value = Min > 0 ? min : (Max < 0 ? max : type {}); }
+
+			/// @brief Explicit copy constructor.
+			/// @tparam Other The integral or strict integral type.
+			/// @param other The value, which must be in range.
+			template <typename Other>
+				requires std::is_integral_v<Other> || STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Other>
+			inline constexpr explicit strict_ranged(const Other other) noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(contains(other), "strict_ranged: construction from a value outside of [Min, Max]");
+
+				if constexpr (std::is_integral_v<Other>) this->value = static_cast<type>(other);
+				else this->value = static_cast<type>(other.value);
+			}
+
+			/// @brief Assignment operator.
+			/// @tparam Other The integral or strict integral type.
+			/// @param other The value, which must be in range.
+			template <typename Other>
+				requires std::is_integral_v<Other> || STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Other>
+			inline constexpr strict_ranged& operator=(const Other other) noexcept {
+				return *this = strict_ranged(other);
+			}
+
+			/// @brief Returns true if [other] is in [Min, Max].
+			/// @returns bool
+			template <typename Other>
+				requires std::is_integral_v<Other> || STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Other>
+			[[nodiscard]] inline constexpr static bool contains(const Other other) noexcept {
+				if constexpr (STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Other>) return contains(other.value);
+				else return STRICT_TYPES_NAMESPACE::details::is_in_range<Type>(other) && static_cast<Type>(other) >= Min && static_cast<Type>(other) <= Max;
+			}
+
+			/// @brief Returns the value, telling the optimizer it is in [Min, Max].
+			/// @returns type
+			[[nodiscard]] inline constexpr type get() const noexcept {
+				this->m_assume_in_range();
+				return this->value;
+			}
+
+			/// @brief Implicit conversion operator.
+			/// @returns type&
+			[[nodiscard]] inline constexpr operator type&() noexcept {
+				this->m_assume_in_range();
+				return this->value;
+			}
+
+			/// @brief Implicit const conversion operator.
+			/// @returns const type&
+			[[nodiscard]] inline constexpr operator const type&() const noexcept {
+				this->m_assume_in_range();
+				return this->value;
+			}
+
+		protected:
+			inline constexpr void m_assume_in_range() const noexcept {
+				if constexpr (min != std::numeric_limits<type>::min()) STRICT_TYPES_ASSUME(this->value >= min);
+				if constexpr (max != std::numeric_limits<type>::max()) STRICT_TYPES_ASSUME(this->value <= max);
+			}
+	};
+
+	namespace details {
+		// Returns true if [Type] is a strict_ranged, or a type defined by STRICT_TYPES_DEFINE_RANGED_TYPE.
+		template <typename Type>
+		concept is_strict_ranged_type = is_strict_integral_type<Type> && requires (const Type value) {
+			{ value.get() } -> std::same_as<typename Type::type>;
+			{ Type::contains(value) } -> std::same_as<bool>;
+		};
+
+		// Returns true if [Left] and [Right] are strict integral types, and either is a strict_ranged.
+		template <typename Left, typename Right>
+		concept is_qualified_ranged_operator = is_qualified_integral_operator<Left, Right> && (is_strict_ranged_type<Left> || is_strict_ranged_type<Right>);
+
+		// Returns true if [Left] is a strict_ranged and [Right] is an arithmetic type.
+		template <typename Left, typename Right>
+		concept is_qualified_ranged_operator_left_only = is_qualified_integral_operator_left_only<Left, Right> && is_strict_ranged_type<Left>;
+
+		// Returns true if [Left] is a scalar type and [Right] is a strict_ranged.
+		template <typename Left, typename Right>
+		concept is_qualified_ranged_operator_right_only = is_qualified_integral_operator_right_only<Left, Right> && is_strict_ranged_type<Right>;
+
+		/// @brief Returns the value of [value], through get() if it is a strict_ranged.
+		/// @returns Type::type
+		template <typename Type>
+		[[nodiscard]] inline constexpr typename Type::type ranged_value(const Type value) noexcept {
+			if constexpr (is_strict_ranged_type<Type>) return value.get();
+			else return value.value;
+		}
+
+		/// @brief Converts the [result] of an operator to [Type], checking it against the range if [Type] is a strict_ranged.
+		/// @returns Type
+		template <typename Type, typename Result>
+		[[nodiscard]] inline constexpr Type ranged_result(const Result result) noexcept {
+			if constexpr (is_strict_ranged_type<Type>) return static_cast<Type>(result);
+			else return static_cast<Type>(static_cast<typename Type::type>(result));
+		}
+	}
+
+	// ==========================================================================
+	// Operators
+	// ==========================================================================
+
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(+)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(-)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(*)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(/)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(&)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(%)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(|)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(^)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(>>)
+	STRICT_TYPES_DEFINE_RANGED_ARITHMETIC_OPERATORS(<<)
+
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(==)
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(!=)
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(>)
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(<)
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(>=)
+	STRICT_TYPES_DEFINE_RANGED_COMPARISON_OPERATORS(<=)
+}
+
+template <typename Type, Type Min, Type Max, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max>, CharType> : std::formatter<decltype(+STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max>::min), CharType> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max> value, FormatContext& context) const {
+			return std::formatter<decltype(+STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max>::min), CharType>::format(+value.get(), context);
+		}
+};
+
+template <typename Type, Type Min, Type Max>
+struct std::hash<STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max> value) const noexcept {
+			return std::hash<typename STRICT_TYPES_NAMESPACE::strict_ranged<Type, Min, Max>::type> {}(value.value);
+		}
+};
+
+// =============================================================================
+// Macros
+// =============================================================================
+
+//	Defines a strict integral-only type bounded by [MIN, MAX], stored in the smallest integral type holding the range.
+#define STRICT_TYPES_DEFINE_RANGED_TYPE(NAME, TYPE, MIN, MAX)                           \
+	namespace STRICT_TYPES_NAMESPACE {                                                   \
+		struct NAME : STRICT_TYPES_NAMESPACE::strict_ranged<TYPE, MIN, MAX> {             \
+				using STRICT_TYPES_NAMESPACE::strict_ranged<TYPE, MIN, MAX>::strict_ranged; \
+				using STRICT_TYPES_NAMESPACE::strict_ranged<TYPE, MIN, MAX>::operator=;     \
+		};                                                                                \
+	}                                                                                    \
+	STRICT_TYPES_DEFINE_FORMATTER(NAME)                                                  \
+	STRICT_TYPES_DEFINE_HASH(NAME)                                                       \
+	STRICT_TYPES_DEFINE_LAYOUT_ASSERTIONS(NAME)                                          \
+	STRICT_TYPES_DEFINE_LAYOUT_FINGERPRINT(NAME)
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
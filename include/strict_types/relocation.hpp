@@ -0,0 +1,84 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+/*
+	relocation.hpp description:
+		This header file contains the is_trivially_relocatable trait, and relocate(),
+		which moves objects into uninitialized storage and ends the lifetime of the
+		originals.
+
+		A type is trivially relocatable when moving an object and destroying the source
+		is equivalent to copying its bytes, which is true of almost every type that does
+		not point into itself. Relocating such types is a single memcpy, even when, like
+		std::unique_ptr, they have non-trivial move constructors and destructors.
+
+		The trait holds for trivially copyable types, std::unique_ptr with a trivially
+		relocatable deleter, std::shared_ptr, and std::basic_string on libc++ (whose
+		small-string buffer holds no self-pointer, unlike the libstdc++ one). Strict alias
+		types inherit the trait of their encapsulated type. Other types can opt in by
+		specializing strict::is_trivially_relocatable.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Returns true if relocating [Type] (moving, then destroying the source) is equivalent to copying its bytes.
+	///
+	//  Requirements:
+	//   - Specializations must only be true for types holding no pointer into themselves,
+	//     and not registered by address anywhere else.
+	/// @tparam Type The type to test.
+	template <typename Type>
+	struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<Type>> { };
+
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_alias_type<Type>
+	struct is_trivially_relocatable<Type> : is_trivially_relocatable<typename Type::type> { };
+
+	template <typename Type, typename Deleter>
+	struct is_trivially_relocatable<std::unique_ptr<Type, Deleter>> : is_trivially_relocatable<Deleter> { };
+
+	template <typename Type>
+	struct is_trivially_relocatable<std::shared_ptr<Type>> : std::true_type { };
+
+#if defined(_LIBCPP_VERSION)
+	template <typename CharType, typename Traits>
+	struct is_trivially_relocatable<std::basic_string<CharType, Traits, std::allocator<CharType>>> : std::true_type { };
+#endif
+
+	template <typename Type>
+	inline constexpr bool is_trivially_relocatable_v = STRICT_TYPES_NAMESPACE::is_trivially_relocatable<std::remove_cv_t<Type>>::value;
+
+	/// @brief Relocates [first, last) into the uninitialized storage at [destination].
+	///
+	//  Requirements:
+	//   - [destination] must not overlap [first, last).
+	//   - The objects of [first, last) are destroyed (or, when trivially relocatable,
+	//     their storage is simply reused): they must not be destroyed again.
+	/// @returns Type* One past the last relocated object.
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::is_trivially_relocatable_v<Type> || std::is_nothrow_move_constructible_v<Type>
+	inline Type* relocate(Type* first, Type* last, Type* destination) noexcept {
+		if constexpr (STRICT_TYPES_NAMESPACE::is_trivially_relocatable_v<Type>) {
+			const auto count = static_cast<std::size_t>(last - first);
+
+			// Cast to void* to silence -Wclass-memaccess, which does not know about relocation.
+			if (count != 0) std::memcpy(static_cast<void*>(destination), static_cast<const void*>(first), count * sizeof(Type));
+
+			return destination + count;
+		}
+		else {
+			for (; first != last; ++first, ++destination) {
+				std::construct_at(destination, std::move(*first));
+				std::destroy_at(first);
+			}
+
+			return destination;
+		}
+	}
+}
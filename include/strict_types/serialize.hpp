@@ -0,0 +1,231 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/endian.hpp"
+#include "strict_types/macros.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/*
+	serialize.hpp description:
+		This header file contains allocation-free binary serialization of strict types
+		into caller-provided byte buffers, in a fixed byte order (little-endian unless
+		specified otherwise):
+
+			std::array<std::byte, 16> buffer;
+
+			auto output = strict::serialize(id, buffer);           // strict::uint32_t.
+			output      = strict::serialize(weight, output);       // strict::float_t.
+
+			auto input = strict::deserialize(id, buffer);          // Reads it back, typed.
+
+		Strict integral and strict float types, strict alias types of serializable types,
+		and the arithmetic and enumeration types they encapsulate are serializable. Each
+		value is written as exactly sizeof(value) bytes, with no padding or framing. Ranged
+		types are read through their constructor, so out-of-range bytes fail its check at
+		the checked strictness level.
+
+		Spans and contiguous ranges of values are serialized in bulk: a single memcpy
+		when the byte order matches the host's, and a vectorizable byteswap loop otherwise.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		// Returns true if [Type] is serialized as its own bytes: integral (including bool and character)
+		// types, enumerations, and 4-byte or 8-byte floating-point types.
+		template <typename Type>
+		concept is_serializable_leaf = (std::is_integral_v<Type> || std::is_enum_v<Type> || (std::is_floating_point_v<Type> && (sizeof(Type) == 4 || sizeof(Type) == 8)))
+											  && !std::is_void_v<STRICT_TYPES_NAMESPACE::details::unsigned_of_size_t<sizeof(Type)>>;
+
+		/// @brief The leaf type [Type] is serialized as, found by unwrapping strict types.
+		template <typename Type>
+		struct serial_leaf {
+				using type = Type;
+		};
+
+		template <typename Type>
+			requires is_strict_type<Type> || is_strict_alias_type<Type>
+		struct serial_leaf<Type> : serial_leaf<typename Type::type> { };
+
+		template <typename Type>
+		using serial_leaf_t = typename serial_leaf<std::remove_cv_t<Type>>::type;
+
+		// Returns true if [Type] can be serialized: a leaf type, or strict types encapsulating one.
+		template <typename Type>
+		concept is_serializable = is_serializable_leaf<serial_leaf_t<Type>>;
+
+		/// @brief Returns the innermost value of [value]: its leaf, or a proxy converting to and from it, such as the storage of strict::big_endian.
+		/// @returns const auto&
+		template <typename Type>
+		[[nodiscard]] inline constexpr decltype(auto) serial_value(const Type& value) noexcept {
+			if constexpr (is_strict_type<Type> || is_strict_alias_type<Type>) return serial_value(value.value);
+			else return value;
+		}
+
+		/// @brief Returns the innermost value of [value]: its leaf, or a proxy converting to and from it, such as the storage of strict::big_endian.
+		/// @returns auto&
+		template <typename Type>
+		[[nodiscard]] inline constexpr decltype(auto) serial_value(Type& value) noexcept {
+			if constexpr (is_strict_type<Type> || is_strict_alias_type<Type>) return serial_value(value.value);
+			else return value;
+		}
+
+		/// @brief Returns true if [Type], or a strict type it encapsulates, restricts its values with a static contains(), such as strict::strict_ranged.
+		/// @returns bool
+		template <typename Type>
+		[[nodiscard]] inline constexpr bool is_range_checked() noexcept {
+			if constexpr (requires (const serial_leaf_t<Type> leaf) { { Type::contains(leaf) } -> std::same_as<bool>; }) return true;
+			else if constexpr (is_strict_type<Type> || is_strict_alias_type<Type>) return is_range_checked<typename Type::type>();
+			else return false;
+		}
+
+		// Returns true if an array of [Type] can be read from and written to bytes with a single memcpy
+		// in the native byte order: trivially copyable, with no bytes besides its leaf stored natively,
+		// and no invalid bit patterns or out-of-range values.
+		template <typename Type>
+		concept is_memcpy_serializable = is_serializable<Type>
+												&& std::is_trivially_copyable_v<Type>
+												&& sizeof(Type) == sizeof(serial_leaf_t<Type>)
+												&& std::is_same_v<decltype(serial_value(std::declval<const Type&>())), const serial_leaf_t<Type>&>
+												&& !std::is_same_v<serial_leaf_t<Type>, bool>
+												&& !is_range_checked<Type>();
+
+		/// @brief Writes [value] into [output] in [Order].
+		template <std::endian Order, typename Type>
+		inline void serialize_unchecked(const Type& value, std::byte* const output) noexcept {
+			using leaf_type = serial_leaf_t<Type>;
+			using bits_type = unsigned_of_size_t<sizeof(leaf_type)>;
+
+			const auto bits = STRICT_TYPES_NAMESPACE::details::to_byte_order<Order>(std::bit_cast<bits_type>(static_cast<leaf_type>(serial_value(value))));
+
+			std::memcpy(output, &bits, sizeof(bits));
+		}
+
+		/// @brief Stores [leaf] into [value], constructing range-checked types such as strict::strict_ranged so their check runs.
+		template <typename Type, typename Leaf>
+		inline constexpr void deserialize_value(Type& value, const Leaf leaf) noexcept {
+			if constexpr (requires { { Type::contains(leaf) } -> std::same_as<bool>; }) value = Type(leaf);
+			else if constexpr (is_strict_type<Type> || is_strict_alias_type<Type>) deserialize_value(value.value, leaf);
+			else value = leaf;
+		}
+
+		/// @brief Reads [value] from [input] in [Order].
+		template <std::endian Order, typename Type>
+		inline void deserialize_unchecked(Type& value, const std::byte* const input) noexcept {
+			using leaf_type = serial_leaf_t<Type>;
+			using bits_type = unsigned_of_size_t<sizeof(leaf_type)>;
+
+			bits_type bits;
+			std::memcpy(&bits, input, sizeof(bits));
+			bits = STRICT_TYPES_NAMESPACE::details::to_byte_order<Order>(bits);
+
+			// Any byte other than 0 is true, as a bool must not hold any other bit pattern than 0 or 1.
+			if constexpr (std::is_same_v<leaf_type, bool>) deserialize_value(value, bits != 0);
+			else deserialize_value(value, std::bit_cast<leaf_type>(bits));
+		}
+	}
+
+	/// @brief The number of bytes [Type] is serialized as.
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_serializable<Type>
+	inline constexpr std::size_t serialized_size_v = sizeof(STRICT_TYPES_NAMESPACE::details::serial_leaf_t<Type>);
+
+	/// @brief Writes [value] at the start of [output] in [Order].
+	///
+	//  Requirements:
+	//   - [output] must hold at least serialized_size_v<Type> bytes, checked by STRICT_TYPES_ASSERT.
+	/// @tparam Order The byte order to write in.
+	/// @returns std::span<std::byte> The rest of [output], following the written bytes.
+	template <std::endian Order = std::endian::little, typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_serializable<Type>
+	inline std::span<std::byte> serialize(const Type& value, const std::span<std::byte> output) noexcept {
+		STRICT_TYPES_ASSERT(output.size() >= serialized_size_v<Type>, "serialize: output buffer too small");
+
+		STRICT_TYPES_NAMESPACE::details::serialize_unchecked<Order>(value, output.data());
+
+		return output.subspan(serialized_size_v<Type>);
+	}
+
+	/// @brief Reads [value] from the start of [input] in [Order].
+	///
+	//  Requirements:
+	//   - [input] must hold at least serialized_size_v<Type> bytes, checked by STRICT_TYPES_ASSERT.
+	/// @tparam Order The byte order to read in.
+	/// @returns std::span<const std::byte> The rest of [input], following the read bytes.
+	template <std::endian Order = std::endian::little, typename Type>
+		requires STRICT_TYPES_NAMESPACE::details::is_serializable<Type>
+	inline std::span<const std::byte> deserialize(Type& value, const std::span<const std::byte> input) noexcept {
+		STRICT_TYPES_ASSERT(input.size() >= serialized_size_v<Type>, "deserialize: input buffer too small");
+
+		STRICT_TYPES_NAMESPACE::details::deserialize_unchecked<Order>(value, input.data());
+
+		return input.subspan(serialized_size_v<Type>);
+	}
+
+	/// @brief Writes every value of [values] at the start of [output] in [Order].
+	///
+	//  Requirements:
+	//   - [output] must hold at least size(values) * serialized_size_v bytes, checked by STRICT_TYPES_ASSERT.
+	/// @tparam Order The byte order to write in.
+	/// @tparam Range The contiguous range type, such as std::vector or std::span.
+	/// @returns std::span<std::byte> The rest of [output], following the written bytes.
+	template <std::endian Order = std::endian::little, std::ranges::contiguous_range Range>
+		requires std::ranges::sized_range<Range> && STRICT_TYPES_NAMESPACE::details::is_serializable<std::ranges::range_value_t<Range>>
+	inline std::span<std::byte> serialize(Range&& values, const std::span<std::byte> output) noexcept {
+		using value_type = std::ranges::range_value_t<Range>;
+
+		const std::size_t count = std::ranges::size(values);
+		const std::size_t bytes = count * serialized_size_v<value_type>;
+
+		STRICT_TYPES_ASSERT(output.size() >= bytes, "serialize: output buffer too small");
+
+		if constexpr (Order == std::endian::native && STRICT_TYPES_NAMESPACE::details::is_memcpy_serializable<value_type>) {
+			if (bytes != 0) std::memcpy(output.data(), std::ranges::data(values), bytes);
+		}
+		else {
+			const value_type* const data = std::ranges::data(values);
+
+			for (std::size_t i = 0; i < count; ++i) STRICT_TYPES_NAMESPACE::details::serialize_unchecked<Order>(data[i], output.data() + i * serialized_size_v<value_type>);
+		}
+
+		return output.subspan(bytes);
+	}
+
+	/// @brief Reads every value of [values] from the start of [input] in [Order].
+	///
+	//  Requirements:
+	//   - [input] must hold at least size(values) * serialized_size_v bytes, checked by STRICT_TYPES_ASSERT.
+	/// @tparam Order The byte order to read in.
+	/// @tparam Range The contiguous range type of mutable values, such as std::vector or std::span.
+	/// @returns std::span<const std::byte> The rest of [input], following the read bytes.
+	template <std::endian Order = std::endian::little, std::ranges::contiguous_range Range>
+		requires std::ranges::sized_range<Range>
+				&& STRICT_TYPES_NAMESPACE::details::is_serializable<std::ranges::range_value_t<Range>>
+				&& (!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>)
+	inline std::span<const std::byte> deserialize(Range&& values, const std::span<const std::byte> input) noexcept {
+		using value_type = std::ranges::range_value_t<Range>;
+
+		const std::size_t count = std::ranges::size(values);
+		const std::size_t bytes = count * serialized_size_v<value_type>;
+
+		STRICT_TYPES_ASSERT(input.size() >= bytes, "deserialize: input buffer too small");
+
+		if constexpr (Order == std::endian::native && STRICT_TYPES_NAMESPACE::details::is_memcpy_serializable<value_type>) {
+			if (bytes != 0) std::memcpy(std::ranges::data(values), input.data(), bytes);
+		}
+		else {
+			value_type* const data = std::ranges::data(values);
+
+			for (std::size_t i = 0; i < count; ++i) STRICT_TYPES_NAMESPACE::details::deserialize_unchecked<Order>(data[i], input.data() + i * serialized_size_v<value_type>);
+		}
+
+		return input.subspan(bytes);
+	}
+}
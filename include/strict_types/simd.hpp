@@ -0,0 +1,336 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define STRICT_TYPES_SIMD_VECTOR_EXTENSIONS
+#endif
+
+/*
+	simd.hpp description:
+		This header file contains a packed strict type, strict_simd<Type, Width>, holding
+		[Width] lanes of one strict integral or strict float type, and the lane mask
+		produced by comparing two packs. A pack of meters_t stays a pack of meters_t:
+		the operators are defined by the same macros as the scalar strict types, so
+		mixing packs of different strict types does not compile either.
+
+		With GCC and Clang, the lanes are stored in a vector extension type, so every
+		operator lowers to SSE2 on plain x86-64 and to AVX2/AVX-512/NEON when the target
+		enables them, without relying on the auto-vectorizer to see through the
+		wrappers. Other compilers use a portable array with lane-wise loops.
+*/
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief Signed integer with the same size as [Type], used for the lanes of a mask.
+		/// @tparam Type The raw lane type.
+		template <typename Type>
+		using simd_mask_lane_t = std::conditional_t<sizeof(Type) == 1, std::int8_t,
+																  std::conditional_t<sizeof(Type) == 2, std::int16_t,
+																							std::conditional_t<sizeof(Type) == 4, std::int32_t, std::int64_t>>>;
+
+#if defined(STRICT_TYPES_SIMD_VECTOR_EXTENSIONS)
+		/// @brief Vector extension type of [Width] [Type] lanes.
+		/// @tparam Type The raw lane type.
+		/// @tparam Width The number of lanes.
+		template <typename Type, std::size_t Width>
+		struct simd_vector {
+				typedef Type type __attribute__((vector_size(sizeof(Type) * Width)));
+		};
+#else
+		/// @brief Portable storage of [Width] [Type] lanes, used without vector extensions.
+		/// @tparam Type The raw lane type.
+		/// @tparam Width The number of lanes.
+		template <typename Type, std::size_t Width>
+		struct alignas(sizeof(Type) * Width) simd_array {
+				Type lanes[Width] = {};
+
+				[[nodiscard]] inline constexpr Type&		 operator[](const std::size_t index) noexcept { return this->lanes[index]; }
+				[[nodiscard]] inline constexpr const Type& operator[](const std::size_t index) const noexcept { return this->lanes[index]; }
+		};
+
+		/// @brief Returns lane [index] of [value], or [value] itself when it is a single lane value.
+		template <typename Type>
+		[[nodiscard]] inline constexpr auto simd_lane(const Type& value, const std::size_t index) noexcept {
+			if constexpr (requires { value.lanes; }) return value[index];
+			else return value;
+		}
+
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(+)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(-)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(*)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(/)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(%)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(&)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(|)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(^)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(<<)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_OPERATORS(>>)
+
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(==)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(!=)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(>)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(<)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(>=)
+		STRICT_TYPES_DEFINE_SIMD_LANEWISE_COMPARISON_OPERATORS(<=)
+
+		template <typename Type, std::size_t Width>
+		[[nodiscard]] inline constexpr simd_array<Type, Width> operator+(const simd_array<Type, Width>& value) noexcept { return value; }
+
+		template <typename Type, std::size_t Width>
+		[[nodiscard]] inline constexpr simd_array<Type, Width> operator-(const simd_array<Type, Width>& value) noexcept { return simd_array<Type, Width> {} - value; }
+
+		template <typename Type, std::size_t Width>
+		[[nodiscard]] inline constexpr simd_array<Type, Width> operator~(const simd_array<Type, Width>& value) noexcept { return value ^ static_cast<Type>(~Type {}); }
+
+		template <typename Type, std::size_t Width>
+		inline constexpr simd_array<Type, Width>& operator++(simd_array<Type, Width>& value) noexcept { return value += Type {1}; }
+
+		template <typename Type, std::size_t Width>
+		inline constexpr simd_array<Type, Width> operator++(simd_array<Type, Width>& value, int) noexcept {
+			const simd_array<Type, Width> previous = value;
+			value += Type {1};
+			return previous;
+		}
+
+		template <typename Type, std::size_t Width>
+		inline constexpr simd_array<Type, Width>& operator--(simd_array<Type, Width>& value) noexcept { return value -= Type {1}; }
+
+		template <typename Type, std::size_t Width>
+		inline constexpr simd_array<Type, Width> operator--(simd_array<Type, Width>& value, int) noexcept {
+			const simd_array<Type, Width> previous = value;
+			value -= Type {1};
+			return previous;
+		}
+
+		/// @brief Portable storage of [Width] [Type] lanes, used without vector extensions.
+		/// @tparam Type The raw lane type.
+		/// @tparam Width The number of lanes.
+		template <typename Type, std::size_t Width>
+		struct simd_vector {
+				using type = simd_array<Type, Width>;
+		};
+#endif
+
+		/// @brief Storage of [Width] [Type] lanes.
+		/// @tparam Type The raw lane type.
+		/// @tparam Width The number of lanes.
+		template <typename Type, std::size_t Width>
+		using simd_vector_t = typename simd_vector<Type, Width>::type;
+
+		// Returns true if [Type] is a strict integral or strict float type whose encapsulated type can be a vector lane.
+		template <typename Type>
+		concept is_simd_lane_type = (is_strict_integral_type<Type> || is_strict_float_type<Type>)
+										 && is_natively_stored_type<Type>
+										 && std::is_arithmetic_v<typename Type::type>
+										 && !std::is_same_v<typename Type::type, bool>
+										 && !std::is_same_v<typename Type::type, long double>
+										 && sizeof(Type) == sizeof(typename Type::type);
+	}
+
+	/// @brief Mask of [Width] lanes, produced by comparing two strict_simd packs.
+	///
+	//  Every lane is all ones when the comparison holds, and zero otherwise.
+	/// @tparam Type The raw lane type of the compared packs.
+	/// @tparam Width The number of lanes.
+	template <typename Type, std::size_t Width>
+	struct strict_simd_mask {
+			using type = STRICT_TYPES_NAMESPACE::details::simd_vector_t<STRICT_TYPES_NAMESPACE::details::simd_mask_lane_t<Type>, Width>;
+
+			inline constexpr static std::size_t width = Width;
+
+			type value = {};
+
+			/// @brief Default constructor. Every lane is cleared.
+			inline constexpr strict_simd_mask() noexcept = default;
+
+			/// @brief Explicit constructor from the lane storage.
+			inline constexpr explicit strict_simd_mask(const type value) noexcept :
+				value(value) { }
+
+			/// @brief Returns true if lane [index] is set.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool operator[](const std::size_t index) const noexcept { return this->value[index] != 0; }
+
+			/// @brief Returns the number of set lanes.
+			/// @returns std::size_t
+			[[nodiscard]] inline constexpr std::size_t count() const noexcept {
+				std::size_t count = 0;
+				for (std::size_t i = 0; i < Width; ++i) count += (this->value[i] != 0);
+				return count;
+			}
+
+			/// @brief Returns true if every lane is set.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool all() const noexcept { return this->count() == Width; }
+
+			/// @brief Returns true if at least one lane is set.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool any() const noexcept { return this->count() != 0; }
+
+			/// @brief Returns true if no lane is set.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool none() const noexcept { return this->count() == 0; }
+
+			[[nodiscard]] friend inline constexpr strict_simd_mask operator&(const strict_simd_mask left, const strict_simd_mask right) noexcept { return strict_simd_mask(left.value & right.value); }
+			[[nodiscard]] friend inline constexpr strict_simd_mask operator|(const strict_simd_mask left, const strict_simd_mask right) noexcept { return strict_simd_mask(left.value | right.value); }
+			[[nodiscard]] friend inline constexpr strict_simd_mask operator^(const strict_simd_mask left, const strict_simd_mask right) noexcept { return strict_simd_mask(left.value ^ right.value); }
+			[[nodiscard]] friend inline constexpr strict_simd_mask operator~(const strict_simd_mask mask) noexcept { return strict_simd_mask(~mask.value); }
+	};
+
+	/// @brief Pack of [Width] lanes of one strict integral or strict float type.
+	///
+	//  Requirements:
+	//   - Type must be a strict integral or strict float type, with the same size as its encapsulated type.
+	//   - The encapsulated type cannot be bool or long double.
+	//   - Width must be a power of two.
+	//
+	//  Usage example:
+	//     const auto lengths = strict::strict_simd<length_t, 8>::load(column);
+	//     (lengths * 2).store(output);
+	/// @tparam Type The strict lane type.
+	/// @tparam Width The number of lanes.
+	template <typename Type, std::size_t Width>
+		requires STRICT_TYPES_NAMESPACE::details::is_simd_lane_type<Type> && (std::has_single_bit(Width))
+	struct strict_simd {
+			using element_type = Type;
+			using lane_type	 = typename Type::type;
+			using type			 = STRICT_TYPES_NAMESPACE::details::simd_vector_t<lane_type, Width>;
+			using mask_type	 = STRICT_TYPES_NAMESPACE::strict_simd_mask<lane_type, Width>;
+
+			inline constexpr static std::size_t width = Width;
+
+			type value = {};
+
+			/// @brief Default constructor. Every lane is zero.
+			inline constexpr strict_simd() noexcept = default;
+
+			/// @brief Explicit constructor from the lane storage.
+			inline constexpr explicit strict_simd(const type value) noexcept :
+				value(value) { }
+
+			/// @brief Explicit broadcast constructor. Every lane is set to [element].
+			inline constexpr explicit strict_simd(const Type element) noexcept {
+				for (std::size_t i = 0; i < Width; ++i) this->value[i] = element.value;
+			}
+
+			/// @brief Loads the first [Width] elements of [elements].
+			/// @returns strict_simd
+			[[nodiscard]] inline static strict_simd load(const std::span<const Type> elements) noexcept {
+				STRICT_TYPES_ASSERT(elements.size() >= Width, "strict_simd: load() from a span shorter than the pack");
+
+				strict_simd result;
+				std::memcpy(static_cast<void*>(&result.value), elements.data(), sizeof(type));
+				return result;
+			}
+
+			/// @brief Stores every lane into the first [Width] elements of [elements].
+			inline void store(const std::span<Type> elements) const noexcept {
+				STRICT_TYPES_ASSERT(elements.size() >= Width, "strict_simd: store() into a span shorter than the pack");
+
+				std::memcpy(static_cast<void*>(elements.data()), &this->value, sizeof(type));
+			}
+
+			/// @brief Returns lane [index].
+			/// @returns Type
+			[[nodiscard]] inline constexpr Type operator[](const std::size_t index) const noexcept { return static_cast<Type>(this->value[index]); }
+
+			/// @brief Sets lane [index] to [element].
+			inline constexpr void set(const std::size_t index, const Type element) noexcept { this->value[index] = element.value; }
+	};
+
+	namespace details {
+		// Returns true if [Type] is a strict_simd pack.
+		template <typename Type>
+		concept is_strict_simd_type = requires { typename Type::element_type; } && std::is_same_v<Type, STRICT_TYPES_NAMESPACE::strict_simd<typename Type::element_type, Type::width>>;
+
+		// Returns true if [Type] is a strict_simd pack of a strict integral type, and every [Others] is the same pack.
+		template <typename Type, typename... Others>
+		concept is_qualified_integral_simd_operator = is_strict_simd_type<Type> && is_strict_integral_type<typename Type::element_type> && (std::is_same_v<Type, Others> && ...);
+
+		// Returns true if [Left] is a strict_simd pack of a strict integral type and [Right] is its lane type.
+		template <typename Left, typename Right>
+		concept is_qualified_integral_simd_operator_left_only = is_qualified_integral_simd_operator<Left> && std::is_same_v<Right, typename Left::lane_type>;
+
+		// A pack is never the right operand of a scalar, as the result would lose the pack type.
+		template <typename Left, typename Right>
+		concept is_qualified_integral_simd_operator_right_only = false;
+
+		// Returns true if [Type] is a strict_simd pack of a strict float type, and every [Others] is the same pack.
+		template <typename Type, typename... Others>
+		concept is_qualified_float_simd_operator = is_strict_simd_type<Type> && is_strict_float_type<typename Type::element_type> && (std::is_same_v<Type, Others> && ...);
+
+		// Returns true if [Left] is a strict_simd pack of a strict float type and [Right] is its lane type.
+		template <typename Left, typename Right>
+		concept is_qualified_float_simd_operator_left_only = is_qualified_float_simd_operator<Left> && std::is_same_v<Right, typename Left::lane_type>;
+
+		// A pack is never the right operand of a scalar, as the result would lose the pack type.
+		template <typename Left, typename Right>
+		concept is_qualified_float_simd_operator_right_only = false;
+	}
+
+	/// @brief Returns a pack holding the lanes of [if_true] where [mask] is set, and the lanes of [if_false] elsewhere.
+	/// @returns strict_simd<Type, Width>
+	template <typename Type, std::size_t Width>
+	[[nodiscard]] inline constexpr STRICT_TYPES_NAMESPACE::strict_simd<Type, Width> select(const typename STRICT_TYPES_NAMESPACE::strict_simd<Type, Width>::mask_type mask, const STRICT_TYPES_NAMESPACE::strict_simd<Type, Width> if_true, const STRICT_TYPES_NAMESPACE::strict_simd<Type, Width> if_false) noexcept {
+#if defined(STRICT_TYPES_SIMD_VECTOR_EXTENSIONS)
+		return STRICT_TYPES_NAMESPACE::strict_simd<Type, Width>(mask.value ? if_true.value : if_false.value);
+#else
+		STRICT_TYPES_NAMESPACE::strict_simd<Type, Width> result;
+		for (std::size_t i = 0; i < Width; ++i) result.value[i] = mask.value[i] ? if_true.value[i] : if_false.value[i];
+		return result;
+#endif
+	}
+
+	// ==========================================================================
+	// Operators
+	// ==========================================================================
+
+	STRICT_TYPES_DEFINE_UNARY_INCR_DECR_OPERATORS(integral_simd)
+	STRICT_TYPES_DEFINE_UNARY_INCR_DECR_OPERATORS(float_simd)
+
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(+, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(-, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(*, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(/, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(%, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(&, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(|, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(^, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(>>, integral_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(<<, integral_simd)
+
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(+, float_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(-, float_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(*, float_simd)
+	STRICT_TYPES_DEFINE_ARITHMETIC_OPERATORS(/, float_simd)
+
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(==, integral_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(!=, integral_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(>, integral_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(<, integral_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(>=, integral_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(<=, integral_simd)
+
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(==, float_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(!=, float_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(>, float_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(<, float_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(>=, float_simd)
+	STRICT_TYPES_DEFINE_SIMD_COMPARISON_OPERATORS(<=, float_simd)
+}
+
+#pragma GCC diagnostic pop
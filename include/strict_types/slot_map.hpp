@@ -0,0 +1,216 @@
+#pragma once
+
+#include "strict_types/handle.hpp"
+#include "strict_types/macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+	slot_map.hpp description:
+		This header file contains a slot map: a container handing out generational
+		handles to its values, with O(1) insertion, erasure and lookup.
+
+		Values are kept densely packed in one vector, so iteration is a plain loop over
+		contiguous memory. Each handle refers to a slot, which records where its value
+		currently lives and the generation of its current occupant. Erasing a value moves
+		the last value into the gap, bumps the generation of the slot, and pushes the slot
+		onto a free list for reuse, so handles to erased values are detected as stale.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Container of densely packed values, addressed through generational handles.
+	///
+	//  Requirements:
+	//   - Handle must be a strict::handle.
+	//   - Erasing reorders the values: the last value moves into the erased position.
+	//   - The generation of a slot wraps after 2^GenerationBits erasures (256 by default).
+	//     A stale handle whose slot was reused a multiple of that many times refers to
+	//     the value now occupying the slot, so keep handles no longer than that, or use
+	//     more generation bits.
+	/// @tparam Tag The tag type of the handles.
+	/// @tparam Type The value type.
+	/// @tparam Handle The handle type.
+	template <typename Tag, typename Type, typename Handle = STRICT_TYPES_NAMESPACE::handle<Tag>>
+		requires std::is_same_v<typename Handle::tag_type, Tag>
+	struct slot_map {
+			using handle_type		 = Handle;
+			using value_type		 = Type;
+			using size_type		 = std::size_t;
+			using iterator			 = typename std::vector<Type>::iterator;
+			using const_iterator	 = typename std::vector<Type>::const_iterator;
+			using reference		 = Type&;
+			using const_reference = const Type&;
+
+			/// @brief Default constructor.
+			inline slot_map() noexcept = default;
+
+			/// @brief Inserts [value], and returns its handle.
+			///
+			//  Requirements:
+			//   - Fewer than Handle::max_index + 1 slots may exist.
+			/// @returns Handle
+			template <typename... Args>
+			inline Handle emplace(Args&&... args) {
+				// Grows every vector up front, so only the construction of the value can throw.
+				if (this->m_values.size() == this->m_values.capacity()) this->reserve(std::max<size_type>(8, this->m_values.size() * 2));
+
+				const auto dense = static_cast<typename Handle::type>(this->m_values.size());
+
+				this->m_values.emplace_back(std::forward<Args>(args)...);
+
+				if (this->m_free_head == Handle::null_value) {
+					STRICT_TYPES_ASSERT(this->m_slots.size() <= Handle::max_index, "slot_map: out of slots");
+
+					this->m_slots.push_back({dense, 0});
+					this->m_dense_slots.push_back(static_cast<typename Handle::type>(this->m_slots.size() - 1));
+				}
+				else {
+					const typename Handle::type free = this->m_free_head;
+
+					this->m_free_head			  = this->m_slots[free].index;
+					this->m_slots[free].index = dense;
+					this->m_dense_slots.push_back(free);
+				}
+
+				const typename Handle::type slot = this->m_dense_slots.back();
+
+				return Handle(slot, this->m_slots[slot].generation);
+			}
+
+			/// @brief Inserts [value], and returns its handle.
+			/// @returns Handle
+			inline Handle insert(const Type& value) { return this->emplace(value); }
+
+			/// @brief Inserts [value], and returns its handle.
+			/// @returns Handle
+			inline Handle insert(Type&& value) { return this->emplace(std::move(value)); }
+
+			/// @brief Erases the value of [handle], if it is still alive.
+			/// @returns bool True if a value was erased, false if [handle] was stale or null.
+			inline bool erase(const Handle handle) noexcept(std::is_nothrow_move_assignable_v<Type>) {
+				if (!this->contains(handle)) return false;
+
+				const typename Handle::type slot	 = handle.index();
+				const typename Handle::type dense = this->m_slots[slot].index;
+				const typename Handle::type last	 = static_cast<typename Handle::type>(this->m_values.size() - 1);
+
+				if (dense != last) {
+					this->m_values[dense]									 = std::move(this->m_values[last]);
+					this->m_dense_slots[dense]								 = this->m_dense_slots[last];
+					this->m_slots[this->m_dense_slots[dense]].index = dense;
+				}
+
+				this->m_values.pop_back();
+				this->m_dense_slots.pop_back();
+
+				this->m_slots[slot].generation = (this->m_slots[slot].generation + 1) & Handle::generation_mask;
+				this->m_slots[slot].index		 = this->m_free_head;
+				this->m_free_head					 = slot;
+
+				return true;
+			}
+
+			/// @brief Returns true if [handle] refers to a value that is still alive.
+			/// @returns bool
+			[[nodiscard]] inline bool contains(const Handle handle) const noexcept {
+				const typename Handle::type slot = handle.index();
+
+				if (slot >= this->m_slots.size() || this->m_slots[slot].generation != handle.generation()) return false;
+
+				// Erasing bumps the generation of a slot, so only the handle of its current occupant
+				// matches. Once the generation wraps, a stale handle can match a free slot again,
+				// whose index links the free list: the slot must also be in use.
+				const typename Handle::type dense = this->m_slots[slot].index;
+
+				return dense < this->m_dense_slots.size() && this->m_dense_slots[dense] == slot;
+			}
+
+			/// @brief Returns a pointer to the value of [handle], or nullptr if it is stale or null.
+			/// @returns Type*
+			[[nodiscard]] inline Type* find(const Handle handle) noexcept {
+				return this->contains(handle) ? &this->m_values[this->m_slots[handle.index()].index] : nullptr;
+			}
+
+			/// @brief Returns a pointer to the value of [handle], or nullptr if it is stale or null.
+			/// @returns const Type*
+			[[nodiscard]] inline const Type* find(const Handle handle) const noexcept {
+				return this->contains(handle) ? &this->m_values[this->m_slots[handle.index()].index] : nullptr;
+			}
+
+			/// @brief Returns the value of [handle]. [handle] is checked by STRICT_TYPES_ASSERT.
+			/// @returns Type&
+			[[nodiscard]] inline reference operator[](const Handle handle) noexcept {
+				STRICT_TYPES_ASSERT(this->contains(handle), "slot_map: stale or null handle");
+				return this->m_values[this->m_slots[handle.index()].index];
+			}
+
+			/// @brief Returns the value of [handle]. [handle] is checked by STRICT_TYPES_ASSERT.
+			/// @returns const Type&
+			[[nodiscard]] inline const_reference operator[](const Handle handle) const noexcept {
+				STRICT_TYPES_ASSERT(this->contains(handle), "slot_map: stale or null handle");
+				return this->m_values[this->m_slots[handle.index()].index];
+			}
+
+			/// @brief Returns the handle of the value at dense position [position], such as while iterating.
+			/// @returns Handle
+			[[nodiscard]] inline Handle handle_at(const size_type position) const noexcept {
+				STRICT_TYPES_ASSERT(position < this->m_values.size(), "slot_map: position out of range");
+
+				const typename Handle::type slot = this->m_dense_slots[position];
+
+				return Handle(slot, this->m_slots[slot].generation);
+			}
+
+			/// @brief Returns every value, densely packed.
+			/// @returns std::span<Type>
+			[[nodiscard]] inline std::span<Type> values() noexcept { return this->m_values; }
+
+			/// @brief Returns every value, densely packed.
+			/// @returns std::span<const Type>
+			[[nodiscard]] inline std::span<const Type> values() const noexcept { return this->m_values; }
+
+			/// @brief Returns the number of values.
+			/// @returns size_type
+			[[nodiscard]] inline size_type size() const noexcept { return this->m_values.size(); }
+
+			/// @brief Returns true if there are no values.
+			/// @returns bool
+			[[nodiscard]] inline bool empty() const noexcept { return this->m_values.empty(); }
+
+			/// @brief Reserves room for [count] values without reallocating.
+			inline void reserve(const size_type count) {
+				this->m_values.reserve(count);
+				this->m_dense_slots.reserve(count);
+				this->m_slots.reserve(count);
+			}
+
+			/// @brief Erases every value. Every outstanding handle becomes stale.
+			inline void clear() noexcept {
+				while (!this->m_dense_slots.empty()) this->erase(this->handle_at(this->m_dense_slots.size() - 1));
+			}
+
+			[[nodiscard]] inline iterator begin() noexcept { return this->m_values.begin(); }
+			[[nodiscard]] inline const_iterator begin() const noexcept { return this->m_values.begin(); }
+			[[nodiscard]] inline iterator end() noexcept { return this->m_values.end(); }
+			[[nodiscard]] inline const_iterator end() const noexcept { return this->m_values.end(); }
+
+		protected:
+			/// @brief The position of a slot's value and the generation of its occupant.
+			/// While the slot is free, [index] is the next free slot instead.
+			struct slot {
+					typename Handle::type index		 = {};
+					typename Handle::type generation = {};
+			};
+
+			std::vector<Type>						  m_values		= {};
+			std::vector<typename Handle::type> m_dense_slots = {};
+			std::vector<slot>						  m_slots		= {};
+			typename Handle::type				  m_free_head	= Handle::null_value;
+
+	};
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+	soa_vector.hpp description:
+		This header file contains a structure-of-arrays vector. Every field type is
+		stored in its own contiguous column, so scanning a single field only touches
+		the cache lines of that column.
+
+		Columns are addressed by their field type, which is why every field type must
+		be unique: strict types make a good fit, since a column<length_t>() cannot be
+		confused with a column<offset_t>() even though both encapsulate std::size_t.
+		Rows are accessed through lightweight proxies holding a reference to each field.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		// Returns true if [Type] appears exactly once in [Types].
+		template <typename Type, typename... Types>
+		concept is_unique_in = ((std::is_same_v<Type, Types> ? 1 : 0) + ... + 0) == 1;
+
+		// Returns true if no type appears more than once in [Types].
+		template <typename... Types>
+		concept are_unique_types = (is_unique_in<Types, Types...> && ...);
+	}
+
+	/// @brief Structure-of-arrays vector with one contiguous column per field type.
+	///
+	//  Requirements:
+	//   - Every field type must be unique, as columns are addressed by type.
+	//   - Field types must be non-reference object types.
+	/// @tparam Fields The field types of a row.
+	template <typename... Fields>
+		requires (sizeof...(Fields) > 0) && STRICT_TYPES_NAMESPACE::details::are_unique_types<Fields...> && (std::is_object_v<Fields> && ...)
+	struct soa_vector {
+			/// @brief Proxy referencing every field of one row.
+			/// @tparam Const True if the referenced fields are const.
+			template <bool Const>
+			struct basic_row {
+					std::tuple<std::conditional_t<Const, const Fields&, Fields&>...> fields;
+
+					/// @brief Returns the [Field] of the row.
+					/// @returns Field&
+					template <typename Field>
+						requires STRICT_TYPES_NAMESPACE::details::is_unique_in<Field, Fields...>
+					[[nodiscard]] inline constexpr auto& get() const noexcept {
+						return std::get<std::conditional_t<Const, const Field&, Field&>>(this->fields);
+					}
+
+					/// @brief Assigns every field of [other] to the fields of the row.
+					template <bool OtherConst>
+					inline constexpr const basic_row& operator=(const basic_row<OtherConst>& other) const
+						requires (!Const)
+					{
+						((this->get<Fields>() = other.template get<Fields>()), ...);
+						return *this;
+					}
+			};
+
+			using row		 = basic_row<false>;
+			using const_row = basic_row<true>;
+
+			/// @brief Random-access iterator over the rows, yielding row proxies.
+			/// @tparam Const True if the referenced fields are const.
+			template <bool Const>
+			struct basic_iterator {
+					// Rows are proxies, so only the C++20 iterator concept can be random access.
+					using iterator_concept	= std::random_access_iterator_tag;
+					using iterator_category	= std::input_iterator_tag;
+					using difference_type	= std::ptrdiff_t;
+					using value_type			= basic_row<Const>;
+					using reference			= basic_row<Const>;
+
+					std::conditional_t<Const, const soa_vector*, soa_vector*> owner = nullptr;
+					std::size_t																 index = 0;
+
+					[[nodiscard]] inline constexpr reference operator*() const noexcept { return (*this->owner)[this->index]; }
+					[[nodiscard]] inline constexpr reference operator[](const difference_type offset) const noexcept { return (*this->owner)[this->index + offset]; }
+
+					inline constexpr basic_iterator& operator++() noexcept {
+						++this->index;
+						return *this;
+					}
+
+					inline constexpr basic_iterator& operator--() noexcept {
+						--this->index;
+						return *this;
+					}
+
+					inline constexpr basic_iterator operator++(int) noexcept { return {this->owner, this->index++}; }
+					inline constexpr basic_iterator operator--(int) noexcept { return {this->owner, this->index--}; }
+
+					inline constexpr basic_iterator& operator+=(const difference_type offset) noexcept {
+						this->index += offset;
+						return *this;
+					}
+
+					inline constexpr basic_iterator& operator-=(const difference_type offset) noexcept {
+						this->index -= offset;
+						return *this;
+					}
+
+					[[nodiscard]] inline constexpr basic_iterator operator+(const difference_type offset) const noexcept { return {this->owner, this->index + offset}; }
+					[[nodiscard]] inline constexpr basic_iterator operator-(const difference_type offset) const noexcept { return {this->owner, this->index - offset}; }
+
+					[[nodiscard]] friend inline constexpr basic_iterator operator+(const difference_type offset, const basic_iterator& iterator) noexcept { return iterator + offset; }
+
+					[[nodiscard]] inline constexpr difference_type operator-(const basic_iterator& other) const noexcept {
+						return static_cast<difference_type>(this->index) - static_cast<difference_type>(other.index);
+					}
+
+					[[nodiscard]] inline constexpr bool operator==(const basic_iterator& other) const noexcept { return this->index == other.index; }
+					[[nodiscard]] inline constexpr auto operator<=>(const basic_iterator& other) const noexcept { return this->index <=> other.index; }
+			};
+
+			using iterator			= basic_iterator<false>;
+			using const_iterator	= basic_iterator<true>;
+
+			/// @brief Returns the contiguous column of [Field].
+			/// @returns std::span<Field>
+			template <typename Field>
+				requires STRICT_TYPES_NAMESPACE::details::is_unique_in<Field, Fields...>
+			[[nodiscard]] inline constexpr std::span<Field> column() noexcept {
+				return std::get<std::vector<Field>>(this->m_columns);
+			}
+
+			/// @brief Returns the contiguous column of [Field].
+			/// @returns std::span<const Field>
+			template <typename Field>
+				requires STRICT_TYPES_NAMESPACE::details::is_unique_in<Field, Fields...>
+			[[nodiscard]] inline constexpr std::span<const Field> column() const noexcept {
+				return std::get<std::vector<Field>>(this->m_columns);
+			}
+
+			/// @brief Returns a proxy referencing every field of the row at [index].
+			/// @returns row
+			[[nodiscard]] inline constexpr row operator[](const std::size_t index) noexcept {
+				STRICT_TYPES_ASSERT(index < this->size(), "soa_vector: index out of range");
+				return {std::tie(std::get<std::vector<Fields>>(this->m_columns)[index]...)};
+			}
+
+			/// @brief Returns a proxy referencing every field of the row at [index].
+			/// @returns const_row
+			[[nodiscard]] inline constexpr const_row operator[](const std::size_t index) const noexcept {
+				STRICT_TYPES_ASSERT(index < this->size(), "soa_vector: index out of range");
+				return {std::tie(std::get<std::vector<Fields>>(this->m_columns)[index]...)};
+			}
+
+			/// @brief Returns the number of rows.
+			/// @returns std::size_t
+			[[nodiscard]] inline constexpr std::size_t size() const noexcept { return std::get<0>(this->m_columns).size(); }
+
+			/// @brief Returns true if there are no rows.
+			/// @returns bool
+			[[nodiscard]] inline constexpr bool empty() const noexcept { return std::get<0>(this->m_columns).empty(); }
+
+			/// @brief Reserves storage for [count] rows in every column.
+			inline constexpr void reserve(const std::size_t count) { (std::get<std::vector<Fields>>(this->m_columns).reserve(count), ...); }
+
+			/// @brief Resizes every column to [count] rows. If a column throws while growing, every column keeps its previous size.
+			inline constexpr void resize(const std::size_t count) {
+				rollback_guard guard {this, this->size()};
+
+				(std::get<std::vector<Fields>>(this->m_columns).resize(count), ...);
+
+				guard.owner = nullptr;
+			}
+
+			/// @brief Appends a row. If a column throws, the row is removed from the columns it was already appended to.
+			inline constexpr void push_back(const Fields&... fields) {
+				rollback_guard guard {this, this->size()};
+
+				(std::get<std::vector<Fields>>(this->m_columns).push_back(fields), ...);
+
+				guard.owner = nullptr;
+			}
+
+			/// @brief Appends a row. If a column throws, the row is removed from the columns it was already appended to.
+			inline constexpr void push_back(Fields&&... fields) {
+				rollback_guard guard {this, this->size()};
+
+				(std::get<std::vector<Fields>>(this->m_columns).push_back(std::move(fields)), ...);
+
+				guard.owner = nullptr;
+			}
+
+			/// @brief Removes the last row.
+			inline constexpr void pop_back() noexcept {
+				STRICT_TYPES_ASSERT(!this->empty(), "soa_vector: pop_back() on an empty vector");
+				(std::get<std::vector<Fields>>(this->m_columns).pop_back(), ...);
+			}
+
+			/// @brief Removes the row at [index] by moving the last row into its place. Does not preserve row order.
+			inline constexpr void swap_remove(const std::size_t index) noexcept((std::is_nothrow_move_assignable_v<Fields> && ...)) {
+				STRICT_TYPES_ASSERT(index < this->size(), "soa_vector: index out of range");
+
+				if (const std::size_t last = this->size() - 1; index != last) {
+					((std::get<std::vector<Fields>>(this->m_columns)[index] = std::move(std::get<std::vector<Fields>>(this->m_columns)[last])), ...);
+				}
+
+				this->pop_back();
+			}
+
+			/// @brief Removes every row.
+			inline constexpr void clear() noexcept { (std::get<std::vector<Fields>>(this->m_columns).clear(), ...); }
+
+			[[nodiscard]] inline constexpr iterator		 begin() noexcept { return {this, 0}; }
+			[[nodiscard]] inline constexpr const_iterator begin() const noexcept { return {this, 0}; }
+			[[nodiscard]] inline constexpr iterator		 end() noexcept { return {this, this->size()}; }
+			[[nodiscard]] inline constexpr const_iterator end() const noexcept { return {this, this->size()}; }
+
+		protected:
+			/// @brief Truncates every column back to [size] rows on destruction, unless [owner] was reset.
+			struct rollback_guard {
+					soa_vector* owner = nullptr;
+					std::size_t size	= 0;
+
+					inline constexpr ~rollback_guard() noexcept {
+						if (this->owner != nullptr) this->owner->m_truncate(this->size);
+					}
+			};
+
+			std::tuple<std::vector<Fields>...> m_columns;
+
+			// Pops the rows past [size] from every column. Unlike resize(), this does not require default-constructible fields.
+			inline constexpr void m_truncate(const std::size_t size) noexcept { (m_truncate_column(std::get<std::vector<Fields>>(this->m_columns), size), ...); }
+
+			template <typename Field>
+			inline constexpr static void m_truncate_column(std::vector<Field>& column, const std::size_t size) noexcept {
+				while (column.size() > size) column.pop_back();
+			}
+	};
+}
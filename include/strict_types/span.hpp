@@ -0,0 +1,106 @@
+#pragma once
+
+#include "strict_types/concepts.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+/*
+	span.hpp description:
+		This header file contains zero-copy reinterpretations between spans of strict
+		integral or strict float values and spans of their encapsulated type, so bulk
+		buffers can be handed to C APIs and SIMD libraries without copying.
+
+		A strict integral or strict float type is a standard-layout struct whose only
+		data member is its encapsulated value, so a pointer to it is pointer-interconvertible
+		with a pointer to that value. Every reinterpretation is guarded by static_asserts
+		on size, alignment, standard layout and trivial copyability.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		// Returns true if [Type] is a strict integral or strict float type, stored as its encapsulated type.
+		template <typename Type>
+		concept is_strict_arithmetic_type = (is_strict_integral_type<Type> || is_strict_float_type<Type>) && is_natively_stored_type<Type>;
+
+		/// @brief Asserts that an array of [Type] can be reinterpreted as an array of its encapsulated type, and back.
+		/// @tparam Type The strict integral or strict float type.
+		template <typename Type>
+		inline constexpr void assert_span_compatible() noexcept {
+			static_assert(sizeof(Type) == sizeof(typename Type::type), "the strict type must have the same size as its encapsulated type");
+			static_assert(alignof(Type) == alignof(typename Type::type), "the strict type must have the same alignment as its encapsulated type");
+			static_assert(std::is_standard_layout_v<Type>, "the strict type must be standard-layout");
+			static_assert(std::is_trivially_copyable_v<Type>, "the strict type must be trivially copyable");
+		}
+	}
+
+	/// @brief Reinterprets a span of strict values as a span of their encapsulated type, without copying.
+	///
+	//  Usage example:
+	//     std::vector<strict::uint32_t> ids = ...;
+	//     c_api_write(strict::as_raw_span(std::span(ids)).data(), ids.size());
+	/// @tparam Type The (const-qualified) strict integral or strict float type.
+	/// @tparam Extent The extent of the span.
+	/// @returns std::span<Type::type, Extent>
+	template <typename Type, std::size_t Extent>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<std::remove_const_t<Type>>
+	[[nodiscard]] inline auto as_raw_span(const std::span<Type, Extent> values) noexcept {
+		STRICT_TYPES_NAMESPACE::details::assert_span_compatible<std::remove_const_t<Type>>();
+
+		using raw_type = std::conditional_t<std::is_const_v<Type>, const typename std::remove_const_t<Type>::type, typename Type::type>;
+
+		return std::span<raw_type, Extent>(reinterpret_cast<raw_type*>(values.data()), values.size());
+	}
+
+	/// @brief Reinterprets a contiguous range of strict values, such as a std::vector, as a span of their encapsulated type.
+	/// @tparam Range The contiguous range type.
+	/// @returns std::span<Type::type>
+	template <std::ranges::contiguous_range Range>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<std::ranges::range_value_t<Range>> && std::ranges::sized_range<Range>
+	[[nodiscard]] inline auto as_raw_span(Range&& values) noexcept {
+		return STRICT_TYPES_NAMESPACE::as_raw_span(std::span(std::ranges::data(values), std::ranges::size(values)));
+	}
+
+	/// @brief Reinterprets a span of raw values as a span of the strict type [Type], without copying.
+	///
+	//  Usage example:
+	//     std::span<std::uint32_t> buffer = ...;
+	//     std::span<strict::uint32_t> ids = strict::as_strict_span<strict::uint32_t>(buffer);
+	/// @tparam Type The strict integral or strict float type.
+	/// @tparam Extent The extent of the span.
+	/// @returns std::span<Type, Extent>
+	template <typename Type, std::size_t Extent>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<Type>
+	[[nodiscard]] inline std::span<Type, Extent> as_strict_span(const std::span<typename Type::type, Extent> values) noexcept {
+		STRICT_TYPES_NAMESPACE::details::assert_span_compatible<Type>();
+
+		return std::span<Type, Extent>(reinterpret_cast<Type*>(values.data()), values.size());
+	}
+
+	/// @brief Reinterprets a span of const raw values as a span of the const strict type [Type], without copying.
+	/// @tparam Type The strict integral or strict float type.
+	/// @tparam Extent The extent of the span.
+	/// @returns std::span<const Type, Extent>
+	template <typename Type, std::size_t Extent>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<Type>
+	[[nodiscard]] inline std::span<const Type, Extent> as_strict_span(const std::span<const typename Type::type, Extent> values) noexcept {
+		STRICT_TYPES_NAMESPACE::details::assert_span_compatible<Type>();
+
+		return std::span<const Type, Extent>(reinterpret_cast<const Type*>(values.data()), values.size());
+	}
+
+	/// @brief Reinterprets a contiguous range of raw values, such as a std::vector, as a span of the strict type [Type].
+	/// @tparam Type The strict integral or strict float type.
+	/// @tparam Range The contiguous range type.
+	/// @returns std::span<Type>
+	template <typename Type, std::ranges::contiguous_range Range>
+		requires STRICT_TYPES_NAMESPACE::details::is_strict_arithmetic_type<Type> && std::ranges::sized_range<Range> && std::is_same_v<std::ranges::range_value_t<Range>, typename Type::type>
+	[[nodiscard]] inline auto as_strict_span(Range&& values) noexcept {
+		return STRICT_TYPES_NAMESPACE::as_strict_span<Type>(std::span(std::ranges::data(values), std::ranges::size(values)));
+	}
+}
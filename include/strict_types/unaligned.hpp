@@ -0,0 +1,193 @@
+#pragma once
+
+#include "strict_types/checks.hpp"
+#include "strict_types/concepts.hpp"
+#include "strict_types/endian.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/macros.hpp"
+
+#include <bit>
+#include <concepts>
+#include <format>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#pragma push_macro("min")
+#pragma push_macro("max")
+
+#undef min
+#undef max
+
+/*
+	unaligned.hpp description:
+		This header file contains strict integral and strict float types with an alignment
+		of 1, so structs of them can be overlaid on packed wire-format buffers at any offset
+		without undefined behavior:
+
+			struct record {
+					strict::unaligned<strict::uint8_t>      kind;
+					strict::unaligned<strict::be_uint32_t>  length;   // At offset 1.
+					strict::unaligned<strict::float_t>      weight;   // At offset 5.
+			};
+
+			static_assert(sizeof(record) == 9);
+
+		The value is stored as bytes, and loaded and stored with std::bit_cast (a memcpy),
+		which compilers lower to single unaligned moves. Unaligned types of strict::big_endian
+		and strict::little_endian types keep their byte order.
+
+		They convert implicitly to their native value and to and from the strict type they
+		are made from, and have the same operators as it.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	namespace details {
+		/// @brief The native arithmetic type, byte order and strict type of [Type]: an arithmetic type, or a strict integral or strict float type.
+		template <typename Type>
+		struct unaligned_underlying {
+				using type									  = Type;
+				using strict_type							  = Type;
+				inline constexpr static std::endian order = std::endian::native;
+		};
+
+		template <typename Type>
+			requires is_strict_integral_type<Type> || is_strict_float_type<Type>
+		struct unaligned_underlying<Type> {
+				using type									  = typename Type::type;
+				using strict_type							  = Type;
+				inline constexpr static std::endian order = std::endian::native;
+		};
+
+		// Types stored in a fixed byte order, such as strict::big_endian, keep it and the strict type they were made from.
+		template <typename Type>
+			requires (is_strict_integral_type<Type> || is_strict_float_type<Type>) && requires { { Type::order } -> std::convertible_to<std::endian>; }
+		struct unaligned_underlying<Type> {
+				using type									  = typename Type::type;
+				using strict_type							  = typename Type::strict_type;
+				inline constexpr static std::endian order = Type::order;
+		};
+	}
+
+	/// @brief Strictly-typed arithmetic encapsulation struct with an alignment of 1, stored in [Order].
+	///
+	//  Requirements:
+	//   - Type must be a 1, 2, 4 or 8-byte integral type other than bool, or a float or double.
+	//   - The operators are those of integral.hpp or float.hpp, which read and write the native value through .value.
+	/// @tparam Type The native arithmetic type.
+	/// @tparam Order The byte order of the storage.
+	/// @tparam Strict The strict integral or strict float type the type was made from, or [Type]. Keeps unaligned<meters_t> and unaligned<seconds_t> distinct.
+	template <typename Type, std::endian Order = std::endian::native, typename Strict = Type>
+		requires (std::is_integral_v<Type> || std::is_floating_point_v<Type>)
+					&& (!std::is_same_v<Type, bool>)
+					&& (!std::is_void_v<STRICT_TYPES_NAMESPACE::details::unsigned_of_size_t<sizeof(Type)>>)
+	struct strict_unaligned_type : std::conditional_t<std::is_integral_v<Type>, STRICT_TYPES_NAMESPACE::details::strict_types_integral_base_t, STRICT_TYPES_NAMESPACE::details::strict_types_float_base_t> {
+			inline constexpr static Type min			 = std::numeric_limits<Type>::min();
+			inline constexpr static Type max			 = std::numeric_limits<Type>::max();
+			inline constexpr static std::endian order = Order;
+
+			using type			= Type;
+			using strict_type = Strict;
+			STRICT_TYPES_NAMESPACE::details::endian_value<Type, Order, false> value = {};
+
+			/// @brief Default constructor.
+			inline constexpr strict_unaligned_type() noexcept = default;
+
+			/// @brief Implicit copy constructor.
+			/// @tparam Other The implicitly-convertible type.
+			/// @param other The implicitly-convertible value.
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_implicit_constructor<Other, Type>
+			inline constexpr strict_unaligned_type(const Other other) noexcept :
+				value(static_cast<Type>(other)) { }
+
+			/// @brief Explicit copy constructor.
+			/// @tparam Other The explicitly-convertible type.
+			/// @param other The explicitly-convertible value.
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_constructor<Other, Type>
+			inline constexpr explicit strict_unaligned_type(const Other other) noexcept :
+				value(static_cast<Type>(other)) {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Type>(other), "strict_types: explicit construction from an out of range value");
+			}
+
+			/// @brief Implicit constructor from the strict type it was made from.
+			/// @param other The strict value.
+			inline constexpr strict_unaligned_type(const Strict other) noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict> || STRICT_TYPES_NAMESPACE::details::is_strict_float_type<Strict>
+				: value(other.value) { }
+
+			/// @brief Returns the native value.
+			/// @returns Type
+			[[nodiscard]] inline constexpr Type get() const noexcept { return this->value; }
+
+			/// @brief Implicit conversion operator, returning the native value.
+			/// @returns Type
+			[[nodiscard]] inline constexpr operator Type() const noexcept { return this->value; }
+
+			/// @brief Implicit conversion operator, returning the value as the strict type it was made from.
+			/// @returns Strict
+			[[nodiscard]] inline constexpr operator Strict() const noexcept
+				requires STRICT_TYPES_NAMESPACE::details::is_strict_integral_type<Strict> || STRICT_TYPES_NAMESPACE::details::is_strict_float_type<Strict> {
+				return static_cast<Strict>(this->get());
+			}
+
+			/// @brief Explicit conversion operator.
+			/// @tparam Other The type to convert to.
+			/// @returns Other
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_explicit_conversion_operator<Type, Other>
+			[[nodiscard]] inline constexpr explicit operator Other() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->get()), "strict_types: narrowing conversion of an out of range value");
+
+				return static_cast<Other>(this->get());
+			}
+
+			/// @brief Conversion function.
+			/// @tparam Other The type to convert to.
+			/// @returns Other
+			template <typename Other>
+				requires STRICT_TYPES_NAMESPACE::details::is_qualified_conversion_function<Type, Other>
+			[[nodiscard]] inline constexpr Other as() const noexcept {
+				STRICT_TYPES_ASSERT_CHECKED(STRICT_TYPES_NAMESPACE::details::is_in_range<Other>(this->get()), "strict_types: narrowing conversion of an out of range value");
+
+				return static_cast<Other>(this->get());
+			}
+
+			/// @brief Converts to a human-readable string representing the current value.
+			/// @returns std::string
+			[[nodiscard]] inline std::string to_string() const { return std::to_string(+this->get()); }
+
+			/// @brief Converts to a human-readable wide string representing the current value.
+			/// @returns std::wstring
+			[[nodiscard]] inline std::wstring to_wstring() const { return std::to_wstring(+this->get()); }
+	};
+
+	/// @brief Arithmetic type with an alignment of 1, for packed wire-format structs.
+	/// @tparam Type The arithmetic type, strict integral or strict float type, or strict::big_endian or strict::little_endian type.
+	template <typename Type>
+	using unaligned = STRICT_TYPES_NAMESPACE::strict_unaligned_type<typename STRICT_TYPES_NAMESPACE::details::unaligned_underlying<Type>::type, STRICT_TYPES_NAMESPACE::details::unaligned_underlying<Type>::order, typename STRICT_TYPES_NAMESPACE::details::unaligned_underlying<Type>::strict_type>;
+}
+
+template <typename Type, std::endian Order, typename Strict, typename CharType>
+struct std::formatter<STRICT_TYPES_NAMESPACE::strict_unaligned_type<Type, Order, Strict>, CharType> : std::formatter<decltype(+Type {}), CharType> {
+		template <typename FormatContext>
+		[[nodiscard]] inline auto format(const STRICT_TYPES_NAMESPACE::strict_unaligned_type<Type, Order, Strict> value, FormatContext& context) const {
+			return std::formatter<decltype(+Type {}), CharType>::format(+value.get(), context);
+		}
+};
+
+template <typename Type, std::endian Order, typename Strict>
+struct std::hash<STRICT_TYPES_NAMESPACE::strict_unaligned_type<Type, Order, Strict>> {
+		[[nodiscard]] inline std::size_t operator()(const STRICT_TYPES_NAMESPACE::strict_unaligned_type<Type, Order, Strict> value) const noexcept {
+			return std::hash<Type> {}(value.get());
+		}
+};
+
+static_assert(alignof(STRICT_TYPES_NAMESPACE::unaligned<std::uint64_t>) == 1, "strict_types: unaligned types must have an alignment of 1");
+static_assert(sizeof(STRICT_TYPES_NAMESPACE::unaligned<std::uint64_t>) == sizeof(std::uint64_t), "strict_types: unaligned types must have the same size as their encapsulated type");
+
+#pragma pop_macro("min")
+#pragma pop_macro("max")
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "strict_types/macros.hpp"
+#include "strict_types/relocation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+	vector.hpp description:
+		This header file contains a vector that grows by relocation: when its element
+		type is trivially relocatable (see relocation.hpp), reallocating moves every
+		element with a single memcpy instead of an element-wise move and destroy, and
+		erasing shifts the tail with a single memmove.
+
+			STRICT_TYPES_DEFINE_ALIAS_TYPE(texture_ptr, std::unique_ptr<texture>)
+
+			strict::vector<strict::texture_ptr> textures;   // Grows with memcpy.
+
+		For trivially copyable types std::vector already takes the memcpy path, so
+		strict::vector pays off for types with non-trivial move constructors or
+		destructors, such as strict alias types of smart pointers.
+*/
+
+namespace STRICT_TYPES_NAMESPACE {
+	/// @brief Contiguous, growable array relocating its elements with memcpy when they are trivially relocatable.
+	///
+	//  Requirements:
+	//   - Type must be trivially relocatable or nothrow move constructible, so growing
+	//     never throws after the new storage is allocated.
+	//   - Uses std::allocator. For other allocators, use strict::relocate() directly.
+	/// @tparam Type The element type.
+	template <typename Type>
+		requires STRICT_TYPES_NAMESPACE::is_trivially_relocatable_v<Type> || std::is_nothrow_move_constructible_v<Type>
+	struct vector {
+			using value_type					= Type;
+			using size_type					= std::size_t;
+			using difference_type			= std::ptrdiff_t;
+			using reference					= Type&;
+			using const_reference			= const Type&;
+			using pointer						= Type*;
+			using const_pointer				= const Type*;
+			using iterator						= Type*;
+			using const_iterator				= const Type*;
+			using reverse_iterator			= std::reverse_iterator<iterator>;
+			using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+			/// @brief Default constructor.
+			//  The other constructors delegate to it, so the destructor releases the storage if filling it throws.
+			inline constexpr vector() noexcept = default;
+
+			/// @brief Constructs [count] value-initialized elements.
+			inline explicit vector(const size_type count) :
+				vector() {
+				this->reserve(count);
+				this->m_end = std::uninitialized_value_construct_n(this->m_begin, count);
+			}
+
+			/// @brief Constructs [count] copies of [value].
+			inline vector(const size_type count, const Type& value) :
+				vector() {
+				this->reserve(count);
+				this->m_end = std::uninitialized_fill_n(this->m_begin, count, value);
+			}
+
+			/// @brief Initializer list constructor.
+			inline vector(const std::initializer_list<Type> values) :
+				vector() {
+				this->reserve(values.size());
+				this->m_end = std::uninitialized_copy(values.begin(), values.end(), this->m_begin);
+			}
+
+			/// @brief Copy constructor.
+			inline vector(const vector& other) :
+				vector() {
+				this->reserve(other.size());
+				this->m_end = std::uninitialized_copy(other.begin(), other.end(), this->m_begin);
+			}
+
+			/// @brief Move constructor.
+			inline vector(vector&& other) noexcept :
+				m_begin(std::exchange(other.m_begin, nullptr)), m_end(std::exchange(other.m_end, nullptr)), m_capacity(std::exchange(other.m_capacity, nullptr)) { }
+
+			/// @brief Copy-assignment operator.
+			inline vector& operator=(const vector& other) {
+				if (this != &other) {
+					vector copy(other);
+					this->swap(copy);
+				}
+
+				return *this;
+			}
+
+			/// @brief Move-assignment operator.
+			inline vector& operator=(vector&& other) noexcept {
+				vector moved(std::move(other));
+				this->swap(moved);
+
+				return *this;
+			}
+
+			inline ~vector() {
+				std::destroy(this->m_begin, this->m_end);
+				this->m_deallocate(this->m_begin, this->capacity());
+			}
+
+			[[nodiscard]] inline Type* data() noexcept { return this->m_begin; }
+			[[nodiscard]] inline const Type* data() const noexcept { return this->m_begin; }
+			[[nodiscard]] inline size_type size() const noexcept { return static_cast<size_type>(this->m_end - this->m_begin); }
+			[[nodiscard]] inline size_type capacity() const noexcept { return static_cast<size_type>(this->m_capacity - this->m_begin); }
+			[[nodiscard]] inline bool empty() const noexcept { return this->m_begin == this->m_end; }
+
+			[[nodiscard]] inline iterator begin() noexcept { return this->m_begin; }
+			[[nodiscard]] inline const_iterator begin() const noexcept { return this->m_begin; }
+			[[nodiscard]] inline iterator end() noexcept { return this->m_end; }
+			[[nodiscard]] inline const_iterator end() const noexcept { return this->m_end; }
+			[[nodiscard]] inline const_iterator cbegin() const noexcept { return this->m_begin; }
+			[[nodiscard]] inline const_iterator cend() const noexcept { return this->m_end; }
+			[[nodiscard]] inline reverse_iterator rbegin() noexcept { return reverse_iterator(this->m_end); }
+			[[nodiscard]] inline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->m_end); }
+			[[nodiscard]] inline reverse_iterator rend() noexcept { return reverse_iterator(this->m_begin); }
+			[[nodiscard]] inline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->m_begin); }
+
+			/// @brief Subscript operator. [index] is checked by STRICT_TYPES_ASSERT.
+			/// @returns Type&
+			[[nodiscard]] inline Type& operator[](const size_type index) noexcept {
+				STRICT_TYPES_ASSERT(index < this->size(), "vector: index out of range");
+				return this->m_begin[index];
+			}
+
+			/// @brief Const subscript operator. [index] is checked by STRICT_TYPES_ASSERT.
+			/// @returns const Type&
+			[[nodiscard]] inline const Type& operator[](const size_type index) const noexcept {
+				STRICT_TYPES_ASSERT(index < this->size(), "vector: index out of range");
+				return this->m_begin[index];
+			}
+
+			[[nodiscard]] inline Type& front() noexcept { return (*this)[0]; }
+			[[nodiscard]] inline const Type& front() const noexcept { return (*this)[0]; }
+			[[nodiscard]] inline Type& back() noexcept { return (*this)[this->size() - 1]; }
+			[[nodiscard]] inline const Type& back() const noexcept { return (*this)[this->size() - 1]; }
+
+			/// @brief Reserves room for [count] elements, relocating the elements if the storage grows.
+			inline void reserve(const size_type count) {
+				if (count > this->capacity()) this->m_reallocate(count);
+			}
+
+			/// @brief Shrinks the storage to the number of elements.
+			inline void shrink_to_fit() {
+				if (this->capacity() != this->size()) this->m_reallocate(this->size());
+			}
+
+			/// @brief Constructs an element at the end from [args], and returns it.
+			/// @returns Type&
+			template <typename... Args>
+			inline Type& emplace_back(Args&&... args) {
+				if (this->m_end != this->m_capacity) {
+					Type* const element = std::construct_at(this->m_end, std::forward<Args>(args)...);
+					++this->m_end;
+
+					return *element;
+				}
+
+				// Constructs the element in the new storage first, as [args] may refer to an element of the old storage.
+				const size_type size	  = this->size();
+				const size_type capacity = this->m_grown_capacity(size + 1);
+				allocation		 storage	  = {this->m_allocate(capacity), capacity};
+
+				std::construct_at(storage.data + size, std::forward<Args>(args)...);
+				STRICT_TYPES_NAMESPACE::relocate(this->m_begin, this->m_end, storage.data);
+				this->m_replace(storage, size + 1);
+
+				return this->m_end[-1];
+			}
+
+			inline void push_back(const Type& value) { this->emplace_back(value); }
+			inline void push_back(Type&& value) { this->emplace_back(std::move(value)); }
+
+			/// @brief Destroys the last element.
+			inline void pop_back() noexcept {
+				STRICT_TYPES_ASSERT(!this->empty(), "vector: pop_back on an empty vector");
+				std::destroy_at(--this->m_end);
+			}
+
+			/// @brief Erases the element at [position], shifting the following elements down.
+			/// @returns iterator The element following the erased one.
+			inline iterator erase(const const_iterator position) noexcept(STRICT_TYPES_NAMESPACE::is_trivially_relocatable_v<Type> || std::is_nothrow_move_assignable_v<Type>) {
+				STRICT_TYPES_ASSERT(position >= this->m_begin && position < this->m_end, "vector: erase position out of range");
+
+				Type* const target = this->m_begin + (position - this->m_begin);
+
+				if constexpr (STRICT_TYPES_NAMESPACE::is_trivially_relocatable_v<Type>) {
+					std::destroy_at(target);
+					std::memmove(static_cast<void*>(target), static_cast<const void*>(target + 1), static_cast<std::size_t>(this->m_end - target - 1) * sizeof(Type));
+					--this->m_end;
+				}
+				else {
+					std::move(target + 1, this->m_end, target);
+					std::destroy_at(--this->m_end);
+				}
+
+				return target;
+			}
+
+			/// @brief Resizes to [count] elements, value-initializing new elements.
+			inline void resize(const size_type count) {
+				if (count <= this->size()) this->m_truncate(count);
+				else {
+					this->reserve(this->m_grown_capacity(count));
+					this->m_end = std::uninitialized_value_construct_n(this->m_end, count - this->size());
+				}
+			}
+
+			/// @brief Resizes to [count] elements, copying [value] into new elements.
+			inline void resize(const size_type count, const Type& value) {
+				if (count <= this->size()) this->m_truncate(count);
+				else if (count <= this->capacity()) this->m_end = std::uninitialized_fill_n(this->m_end, count - this->size(), value);
+				else {
+					// Copies [value] first, as it may refer to an element of the old storage.
+					const Type copy(value);
+
+					this->reserve(this->m_grown_capacity(count));
+					this->m_end = std::uninitialized_fill_n(this->m_end, count - this->size(), copy);
+				}
+			}
+
+			/// @brief Destroys every element, keeping the storage.
+			inline void clear() noexcept { this->m_truncate(0); }
+
+			inline void swap(vector& other) noexcept {
+				std::swap(this->m_begin, other.m_begin);
+				std::swap(this->m_end, other.m_end);
+				std::swap(this->m_capacity, other.m_capacity);
+			}
+
+			[[nodiscard]] inline friend bool operator==(const vector& left, const vector& right) {
+				return std::equal(left.begin(), left.end(), right.begin(), right.end());
+			}
+
+		protected:
+			/// @brief Storage released on destruction, unless it was taken over by m_replace().
+			struct allocation {
+					Type*		 data		  = nullptr;
+					size_type capacity = 0;
+
+					inline ~allocation() { vector::m_deallocate(this->data, this->capacity); }
+			};
+
+			[[nodiscard]] inline static Type* m_allocate(const size_type capacity) { return std::allocator<Type> {}.allocate(capacity); }
+
+			inline static void m_deallocate(Type* const data, const size_type capacity) noexcept {
+				if (data != nullptr) std::allocator<Type> {}.deallocate(data, capacity);
+			}
+
+			// Doubles the capacity, for amortized O(1) growth.
+			[[nodiscard]] inline size_type m_grown_capacity(const size_type required) const noexcept { return std::max(required, this->capacity() * 2); }
+
+			// Takes over [storage], whose first [size] elements are constructed; the old elements must already be relocated.
+			inline void m_replace(allocation& storage, const size_type size) noexcept {
+				m_deallocate(this->m_begin, this->capacity());
+
+				this->m_begin	 = std::exchange(storage.data, nullptr);
+				this->m_end		 = this->m_begin + size;
+				this->m_capacity = this->m_begin + storage.capacity;
+			}
+
+			inline void m_reallocate(const size_type capacity) {
+				const size_type size	  = this->size();
+				allocation		 storage = {capacity != 0 ? this->m_allocate(capacity) : nullptr, capacity};
+
+				STRICT_TYPES_NAMESPACE::relocate(this->m_begin, this->m_end, storage.data);
+				this->m_replace(storage, size);
+			}
+
+			inline void m_truncate(const size_type count) noexcept {
+				std::destroy(this->m_begin + count, this->m_end);
+				this->m_end = this->m_begin + count;
+			}
+
+			Type* m_begin	 = nullptr;
+			Type* m_end		 = nullptr;
+			Type* m_capacity = nullptr;
+	};
+}
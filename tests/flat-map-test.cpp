@@ -0,0 +1,111 @@
+#include "test.hpp"
+
+#include "strict_types/flat_map.hpp"
+#include "strict_types/integral.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+using map_key_t = STRICT_TYPES_NAMESPACE::uint32_t;
+
+// Sends every key to slot 0, so every key after the first probes past its home group.
+struct colliding_hash {
+		[[nodiscard]] inline std::size_t operator()(const map_key_t) const noexcept { return 0; }
+};
+
+void test_insert_find_erase() {
+	STRICT_TYPES_NAMESPACE::flat_map<map_key_t, std::string> map;
+
+	CHECK(map.empty());
+	CHECK(map.find(map_key_t {1}) == nullptr);
+	CHECK(!map.erase(map_key_t {1}));
+
+	CHECK(map.insert(map_key_t {1}, "one"));
+	CHECK(map.insert(map_key_t {2}, "two"));
+	CHECK(!map.insert(map_key_t {1}, "uno"));
+	CHECK(map.size() == 2);
+
+	CHECK(map.contains(map_key_t {1}));
+	CHECK(*map.find(map_key_t {1}) == "one");
+	CHECK(*map.find(map_key_t {2}) == "two");
+	CHECK(!map.contains(map_key_t {3}));
+
+	map[map_key_t {3}] = "three";
+	CHECK(map.size() == 3);
+	CHECK(*map.find(map_key_t {3}) == "three");
+
+	CHECK(map.erase(map_key_t {2}));
+	CHECK(!map.erase(map_key_t {2}));
+	CHECK(!map.contains(map_key_t {2}));
+	CHECK(map.size() == 2);
+
+	std::size_t count = 0;
+
+	for (auto it = map.begin(); it != map.end(); ++it) {
+		CHECK(*map.find(it->first) == it->second);
+		++count;
+	}
+
+	CHECK(count == map.size());
+
+	map.clear();
+	CHECK(map.empty());
+	CHECK(!map.contains(map_key_t {1}));
+}
+
+void test_rehash() {
+	STRICT_TYPES_NAMESPACE::flat_map<map_key_t, std::uint32_t> map;
+
+	for (std::uint32_t i = 0; i < 1000; ++i) CHECK(map.insert(map_key_t {i}, i * 3));
+
+	CHECK(map.size() == 1000);
+	CHECK(map.capacity() * 7 >= map.size() * 8);
+
+	for (std::uint32_t i = 0; i < 1000; ++i) CHECK(map.find(map_key_t {i}) != nullptr && *map.find(map_key_t {i}) == i * 3);
+
+	for (std::uint32_t i = 0; i < 1000; i += 2) CHECK(map.erase(map_key_t {i}));
+
+	for (std::uint32_t i = 0; i < 1000; ++i) CHECK(map.contains(map_key_t {i}) == (i % 2 == 1));
+
+	const STRICT_TYPES_NAMESPACE::flat_map<map_key_t, std::uint32_t> copy = map;
+
+	CHECK(copy.size() == 500);
+	CHECK(*copy.find(map_key_t {999}) == 999 * 3);
+}
+
+void test_probe_groups() {
+	STRICT_TYPES_NAMESPACE::flat_map<map_key_t, std::unique_ptr<std::uint32_t>, colliding_hash> map;
+
+	// Several groups of colliding keys, rehashed more than once.
+	for (std::uint32_t i = 0; i < 40; ++i) CHECK(map.insert(map_key_t {i}, std::make_unique<std::uint32_t>(i)));
+
+	for (std::uint32_t i = 0; i < 40; ++i) CHECK(map.find(map_key_t {i}) != nullptr && **map.find(map_key_t {i}) == i);
+
+	// Erasing from the front of the probe sequence shifts every following key back.
+	for (std::uint32_t i = 0; i < 40; i += 3) CHECK(map.erase(map_key_t {i}));
+
+	for (std::uint32_t i = 0; i < 40; ++i) {
+		if (i % 3 == 0) CHECK(!map.contains(map_key_t {i}));
+		else CHECK(map.find(map_key_t {i}) != nullptr && **map.find(map_key_t {i}) == i);
+	}
+}
+
+void test_reserved_key() {
+	STRICT_TYPES_NAMESPACE::flat_map<map_key_t, std::uint32_t> map;
+
+	CHECK(test::asserts([&] { map.try_emplace(map_key_t {std::numeric_limits<std::uint32_t>::max()}, 1u); }));
+	CHECK(!test::asserts([&] { map.try_emplace(map_key_t {std::numeric_limits<std::uint32_t>::max() - 1}, 1u); }));
+	CHECK(!map.contains(map_key_t {std::numeric_limits<std::uint32_t>::max()}));
+}
+
+int main() {
+	test_insert_find_erase();
+	test_rehash();
+	test_probe_groups();
+	test_reserved_key();
+
+	return test::result();
+}
@@ -0,0 +1,99 @@
+#include "test.hpp"
+
+#include "strict_types/inline_string.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+using namespace std::string_view_literals;
+
+using short_string = STRICT_TYPES_NAMESPACE::inline_string<8>;
+
+static_assert(sizeof(STRICT_TYPES_NAMESPACE::inline_string<22>) == 24);
+static_assert(std::is_same_v<STRICT_TYPES_NAMESPACE::inline_string<300>::size_type, std::uint16_t>);
+static_assert(std::is_trivially_copyable_v<short_string>);
+
+void test_construction() {
+	CHECK(short_string {}.empty());
+	CHECK(short_string {"hello"} == "hello"sv);
+	CHECK(short_string("hello", 4) == "hell"sv);
+	CHECK(short_string {std::string("text")} == "text"sv);
+	CHECK(short_string {"12345678"}.size() == 8);
+	CHECK(*short_string {"abc"}.c_str() == 'a');
+	CHECK(short_string {"abc"}.c_str()[3] == '\0');
+}
+
+void test_modifiers() {
+	short_string text {"ab"};
+
+	text += "cd";
+	text.push_back('e');
+	CHECK(text == "abcde"sv);
+
+	text.pop_back();
+	CHECK(text == "abcd"sv);
+
+	text.resize(6, 'x');
+	CHECK(text == "abcdxx"sv);
+
+	text.resize(2);
+	CHECK(text == "ab"sv);
+	CHECK(text.data()[2] == '\0');
+
+	text = "xyz"sv;
+	CHECK(text == "xyz"sv);
+
+	text.clear();
+	CHECK(text.empty());
+}
+
+void test_self_assignment() {
+	short_string text {"abcdefgh"};
+
+	// Each source overlaps the characters it is copied over.
+	text = text.view().substr(1);
+	CHECK(text == "bcdefgh"sv);
+	CHECK(text.data()[7] == '\0');
+
+	text.assign(text.view().substr(2, 3));
+	CHECK(text == "def"sv);
+
+	text.assign(text.view());
+	CHECK(text == "def"sv);
+
+	text.append(text.view());
+	CHECK(text == "defdef"sv);
+}
+
+void test_capacity() {
+	short_string text {"1234567"};
+
+	CHECK(!short_string::fits("123456789"));
+	CHECK(test::asserts([&] { text.push_back('8'); }) == false);
+	CHECK(test::asserts([&] { text.push_back('9'); }));
+	CHECK(text == "12345678"sv);
+	CHECK(test::asserts([&] { text.assign("123456789"); }));
+
+	// Text past the capacity is truncated when the assertion does not stop the program.
+	CHECK(text == "12345678"sv);
+	CHECK(text.data()[8] == '\0');
+}
+
+void test_comparisons() {
+	CHECK(short_string {"abc"} < short_string {"abd"});
+	CHECK(short_string {"abc"} == std::string("abc"));
+	CHECK(short_string {"b"} > "a"sv);
+	CHECK(std::hash<short_string> {}(short_string {"abc"}) == std::hash<std::string_view> {}("abc"sv));
+}
+
+int main() {
+	test_construction();
+	test_modifiers();
+	test_self_assignment();
+	test_capacity();
+	test_comparisons();
+
+	return test::result();
+}
@@ -0,0 +1,123 @@
+#include "test.hpp"
+
+#include "strict_types/integral.hpp"
+#include "strict_types/mapped_array.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/// @brief A path in the temporary directory, unique to this process, and removed on destruction.
+struct temporary_file {
+		std::filesystem::path path = std::filesystem::temp_directory_path() / ("strict-types-mapped-array-" + std::to_string(::getpid()));
+
+		inline ~temporary_file() { std::filesystem::remove(this->path); }
+};
+
+/// @brief Overwrites the byte at [offset] of the file at [path].
+void patch(const std::filesystem::path& path, const std::streamoff offset, const char byte) {
+	std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+	file.seekp(offset);
+	file.put(byte);
+}
+
+void test_round_trip() {
+	const temporary_file file;
+
+	std::vector<STRICT_TYPES_NAMESPACE::uint32_t> values;
+	for (std::uint32_t index = 0; index < 1000; ++index) values.emplace_back(index * 3);
+
+	CHECK(STRICT_TYPES_NAMESPACE::write_mapped_array(file.path, std::span<const STRICT_TYPES_NAMESPACE::uint32_t>(values)) == STRICT_TYPES_NAMESPACE::mapped_status::ok);
+	CHECK(std::filesystem::file_size(file.path) == 128 + values.size() * sizeof(STRICT_TYPES_NAMESPACE::uint32_t));
+
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::uint32_t> mapped;
+
+	CHECK(mapped.open(file.path, STRICT_TYPES_NAMESPACE::mapped_advice::sequential) == STRICT_TYPES_NAMESPACE::mapped_status::ok);
+	CHECK(mapped.is_open());
+	CHECK(mapped.size() == values.size());
+	CHECK(mapped[0] == values[0]);
+	CHECK(mapped[999] == values[999]);
+	CHECK(std::equal(mapped.begin(), mapped.end(), values.begin(), values.end()));
+	CHECK(mapped.advise(STRICT_TYPES_NAMESPACE::mapped_advice::random));
+
+	// The file stays mapped after it is removed, until the mapping is closed.
+	std::filesystem::remove(file.path);
+
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::uint32_t> moved = std::move(mapped);
+
+	CHECK(!mapped.is_open());
+	CHECK(mapped.data() == nullptr);
+	CHECK(moved.span().size() == values.size());
+	CHECK(moved.span().back() == values.back());
+
+	moved.close();
+	CHECK(!moved.is_open());
+	CHECK(moved.empty());
+	CHECK(!moved.advise(STRICT_TYPES_NAMESPACE::mapped_advice::normal));
+}
+
+void test_empty() {
+	const temporary_file file;
+
+	CHECK(STRICT_TYPES_NAMESPACE::write_mapped_array(file.path, std::span<const STRICT_TYPES_NAMESPACE::int64_t>()) == STRICT_TYPES_NAMESPACE::mapped_status::ok);
+
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::int64_t> mapped;
+
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::ok);
+	CHECK(mapped.empty());
+	CHECK(mapped.begin() == mapped.end());
+}
+
+void test_validation() {
+	const temporary_file file;
+
+	const std::vector<STRICT_TYPES_NAMESPACE::uint32_t> values(16, STRICT_TYPES_NAMESPACE::uint32_t {7});
+
+	CHECK(STRICT_TYPES_NAMESPACE::write_mapped_array(file.path, std::span<const STRICT_TYPES_NAMESPACE::uint32_t>(values)) == STRICT_TYPES_NAMESPACE::mapped_status::ok);
+
+	// Same size and alignment, but another type: only the layout fingerprint tells them apart.
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::int32_t>  signed_mapped;
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::uint16_t> narrow_mapped;
+
+	CHECK(signed_mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::type_mismatch);
+	CHECK(narrow_mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::layout_mismatch);
+	CHECK(!signed_mapped.is_open());
+	CHECK(!narrow_mapped.is_open());
+
+	STRICT_TYPES_NAMESPACE::mapped_array<STRICT_TYPES_NAMESPACE::uint32_t> mapped;
+
+	// Truncates the last element.
+	std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 1);
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::size_mismatch);
+
+	// The byte order flag follows the magic, version, element size and alignment.
+	std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) + 1);
+	patch(file.path, 20, std::endian::native == std::endian::big ? 0 : 1);
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::byte_order_mismatch);
+
+	patch(file.path, 0, 'X');
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::invalid_header);
+
+	std::filesystem::resize_file(file.path, 64);
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::invalid_header);
+
+	std::filesystem::remove(file.path);
+	CHECK(mapped.open(file.path) == STRICT_TYPES_NAMESPACE::mapped_status::open_failed);
+	CHECK(!mapped.is_open());
+}
+
+int main() {
+	test_round_trip();
+	test_empty();
+	test_validation();
+
+	return test::result();
+}
@@ -0,0 +1,84 @@
+#include "test.hpp"
+
+#include "strict_types/integral.hpp"
+#include "strict_types/ranged.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+STRICT_TYPES_DEFINE_RANGED_TYPE(percent_t, int, 0, 100)
+
+using percent = STRICT_TYPES_NAMESPACE::percent_t;
+
+static_assert(std::is_same_v<STRICT_TYPES_NAMESPACE::strict_ranged<int, 0, 255>::type, std::uint8_t>);
+static_assert(std::is_same_v<STRICT_TYPES_NAMESPACE::strict_ranged<int, 0, 1023>::type, std::uint16_t>);
+static_assert(std::is_same_v<STRICT_TYPES_NAMESPACE::strict_ranged<int, -1, 255>::type, std::int16_t>);
+static_assert(std::is_same_v<STRICT_TYPES_NAMESPACE::strict_ranged<long long, 0, 1LL << 40>::type, std::uint64_t>);
+static_assert(sizeof(percent) == 1);
+
+void test_construction() {
+	CHECK(STRICT_TYPES_NAMESPACE::strict_ranged<int, 5, 10> {}.get() == 5);
+	CHECK(STRICT_TYPES_NAMESPACE::strict_ranged<int, -10, -3> {}.get() == -3);
+	CHECK(STRICT_TYPES_NAMESPACE::strict_ranged<int, -1, 255> {}.get() == 0);
+
+	CHECK(percent {42}.get() == 42);
+	CHECK(percent {STRICT_TYPES_NAMESPACE::int32_t {100}}.get() == 100);
+
+	percent value {10};
+	value = 20;
+	CHECK(value.get() == 20);
+}
+
+void test_contains() {
+	CHECK(percent::contains(0));
+	CHECK(percent::contains(100));
+	CHECK(!percent::contains(-1));
+	CHECK(!percent::contains(101));
+	CHECK(!percent::contains(256));
+	CHECK(!percent::contains(-4294967296LL));
+	CHECK(percent::contains(50u));
+	CHECK(!percent::contains(4294967295u));
+	CHECK(percent::contains(STRICT_TYPES_NAMESPACE::int64_t {7}));
+}
+
+void test_operators() {
+	const percent a {60};
+	const percent b {30};
+
+	CHECK((a + b).get() == 90);
+	CHECK((a - b).get() == 30);
+	CHECK((a / b).get() == 2);
+	CHECK((a % b).get() == 0);
+	CHECK((a + 5).get() == 65);
+
+	CHECK(a > b);
+	CHECK(a != b);
+	CHECK(a < 1000);
+	CHECK(a > -1);
+	CHECK(!(a == 1000));
+}
+
+void test_range_checks() {
+	// Out-of-range values are only checked at the checked strictness level.
+	const bool checked = STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_CHECKED;
+
+	CHECK(test::asserts([] { [[maybe_unused]] const percent value {101}; }) == checked);
+	CHECK(test::asserts([] { [[maybe_unused]] const percent value {-1}; }) == checked);
+	CHECK(test::asserts([] { [[maybe_unused]] const percent value = percent {60} + percent {50}; }) == checked);
+	CHECK(test::asserts([] {
+		percent value {0};
+		value = 200;
+	}) == checked);
+
+	CHECK(!test::asserts([] { [[maybe_unused]] const percent value {100}; }));
+	CHECK(!test::asserts([] { [[maybe_unused]] const percent value = percent {60} + percent {40}; }));
+}
+
+int main() {
+	test_construction();
+	test_contains();
+	test_operators();
+	test_range_checks();
+
+	return test::result();
+}
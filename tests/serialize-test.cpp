@@ -0,0 +1,151 @@
+#include "test.hpp"
+
+#include "strict_types/endian.hpp"
+#include "strict_types/float.hpp"
+#include "strict_types/integral.hpp"
+#include "strict_types/ranged.hpp"
+#include "strict_types/serialize.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using bytes = std::array<std::byte, 16>;
+
+enum class color : std::uint8_t { red = 1, green = 2 };
+
+void test_round_trip() {
+	bytes buffer {};
+
+	const STRICT_TYPES_NAMESPACE::uint32_t id {0x01020304u};
+	const STRICT_TYPES_NAMESPACE::float_t  weight {1.5f};
+	const color								  tint = color::green;
+
+	std::span<std::byte> output = STRICT_TYPES_NAMESPACE::serialize(id, buffer);
+	output							  = STRICT_TYPES_NAMESPACE::serialize<std::endian::big>(weight, output);
+	output							  = STRICT_TYPES_NAMESPACE::serialize(tint, output);
+
+	CHECK(output.size() == buffer.size() - 9);
+	CHECK(buffer[0] == std::byte {0x04});
+	CHECK(buffer[3] == std::byte {0x01});
+	CHECK(buffer[4] == std::byte {0x3F});
+
+	STRICT_TYPES_NAMESPACE::uint32_t read_id {};
+	STRICT_TYPES_NAMESPACE::float_t	read_weight {};
+	color										read_tint = color::red;
+
+	std::span<const std::byte> input = STRICT_TYPES_NAMESPACE::deserialize(read_id, std::span<const std::byte>(buffer));
+	input										= STRICT_TYPES_NAMESPACE::deserialize<std::endian::big>(read_weight, input);
+	input										= STRICT_TYPES_NAMESPACE::deserialize(read_tint, input);
+
+	CHECK(read_id == id);
+	CHECK(read_weight == weight);
+	CHECK(read_tint == tint);
+	CHECK(input.size() == buffer.size() - 9);
+}
+
+void test_byte_order_types() {
+	bytes buffer {};
+
+	const STRICT_TYPES_NAMESPACE::be_uint32_t length {0x0A0B0C0Du};
+
+	STRICT_TYPES_NAMESPACE::serialize<std::endian::big>(length, buffer);
+	CHECK(buffer[0] == std::byte {0x0A});
+	CHECK(buffer[3] == std::byte {0x0D});
+
+	STRICT_TYPES_NAMESPACE::le_uint32_t read {};
+	STRICT_TYPES_NAMESPACE::deserialize<std::endian::big>(read, std::span<const std::byte>(buffer));
+	CHECK(read.get() == 0x0A0B0C0Du);
+}
+
+void test_bool() {
+	bytes buffer {};
+	bool	value = false;
+
+	buffer[0] = std::byte {7};
+	STRICT_TYPES_NAMESPACE::deserialize(value, std::span<const std::byte>(buffer));
+	CHECK(value);
+
+	buffer[0] = std::byte {0};
+	STRICT_TYPES_NAMESPACE::deserialize(value, std::span<const std::byte>(buffer));
+	CHECK(!value);
+}
+
+void test_ranges() {
+	std::array<std::byte, 32> buffer {};
+
+	const std::vector<STRICT_TYPES_NAMESPACE::uint16_t> values {STRICT_TYPES_NAMESPACE::uint16_t {1}, STRICT_TYPES_NAMESPACE::uint16_t {0x0203}, STRICT_TYPES_NAMESPACE::uint16_t {4}};
+
+	// One byte order is the native one (memcpy), and the other byteswaps every value.
+	STRICT_TYPES_NAMESPACE::serialize<std::endian::little>(values, buffer);
+	STRICT_TYPES_NAMESPACE::serialize<std::endian::big>(values, std::span<std::byte>(buffer).subspan(6));
+
+	CHECK(buffer[2] == std::byte {0x03});
+	CHECK(buffer[8] == std::byte {0x02});
+
+	std::vector<STRICT_TYPES_NAMESPACE::uint16_t> little(3);
+	std::vector<STRICT_TYPES_NAMESPACE::uint16_t> big(3);
+
+	STRICT_TYPES_NAMESPACE::deserialize<std::endian::little>(little, std::span<const std::byte>(buffer));
+	STRICT_TYPES_NAMESPACE::deserialize<std::endian::big>(big, std::span<const std::byte>(buffer).subspan(6));
+
+	CHECK(little == values);
+	CHECK(big == values);
+}
+
+void test_ranged_values() {
+	using digit = STRICT_TYPES_NAMESPACE::strict_ranged<int, 0, 9>;
+
+	static_assert(!STRICT_TYPES_NAMESPACE::details::is_memcpy_serializable<digit>);
+
+	const bool checked = STRICT_TYPES_STRICTNESS >= STRICT_TYPES_STRICTNESS_CHECKED;
+
+	bytes buffer {};
+	digit value {};
+
+	buffer[0] = std::byte {7};
+	CHECK(!test::asserts([&] { STRICT_TYPES_NAMESPACE::deserialize(value, std::span<const std::byte>(buffer)); }));
+	CHECK(value.get() == 7);
+
+	// Out-of-range bytes go through the constructor of the ranged type, and fail its check.
+	buffer[0] = std::byte {200};
+	CHECK(test::asserts([&] { STRICT_TYPES_NAMESPACE::deserialize(value, std::span<const std::byte>(buffer)); }) == checked);
+
+	std::vector<digit> digits(2);
+
+	buffer[0] = std::byte {3};
+	buffer[1] = std::byte {42};
+	CHECK(test::asserts([&] { STRICT_TYPES_NAMESPACE::deserialize<std::endian::native>(digits, std::span<const std::byte>(buffer)); }) == checked);
+	CHECK(digits[0].get() == 3);
+}
+
+void test_buffer_size() {
+	bytes buffer {};
+
+	// The views are shorter than the buffer, so writing past them after a failed check stays in bounds.
+	const std::span<std::byte>			output = std::span<std::byte>(buffer).first(2);
+	const std::span<const std::byte> input	= std::span<const std::byte>(buffer).first(2);
+
+	STRICT_TYPES_NAMESPACE::uint32_t value {};
+
+	CHECK(!test::asserts([&] { STRICT_TYPES_NAMESPACE::serialize(STRICT_TYPES_NAMESPACE::uint16_t {1}, output); }));
+	CHECK(test::asserts([&] { STRICT_TYPES_NAMESPACE::serialize(value, output); }));
+	CHECK(test::asserts([&] { STRICT_TYPES_NAMESPACE::deserialize(value, input); }));
+
+	CHECK(STRICT_TYPES_NAMESPACE::serialized_size_v<STRICT_TYPES_NAMESPACE::uint64_t> == 8);
+	CHECK(STRICT_TYPES_NAMESPACE::serialized_size_v<STRICT_TYPES_NAMESPACE::be_uint32_t> == 4);
+}
+
+int main() {
+	test_round_trip();
+	test_byte_order_types();
+	test_bool();
+	test_ranges();
+	test_ranged_values();
+	test_buffer_size();
+
+	return test::result();
+}
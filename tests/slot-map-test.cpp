@@ -0,0 +1,98 @@
+#include "test.hpp"
+
+#include "strict_types/handle.hpp"
+#include "strict_types/slot_map.hpp"
+
+#include <cstddef>
+#include <string>
+
+struct name_tag;
+
+using name_map		= STRICT_TYPES_NAMESPACE::slot_map<name_tag, std::string>;
+using name_handle = name_map::handle_type;
+
+void test_insert_find_erase() {
+	name_map names;
+
+	const name_handle first	 = names.insert("first");
+	const name_handle second = names.insert("second");
+	const name_handle third	 = names.insert("third");
+
+	CHECK(names.size() == 3);
+	CHECK(names[first] == "first");
+	CHECK(*names.find(second) == "second");
+	CHECK(names.contains(third));
+
+	// Erasing moves the last value into the gap, and keeps its handle valid.
+	CHECK(names.erase(first));
+	CHECK(!names.erase(first));
+	CHECK(names.size() == 2);
+	CHECK(names[third] == "third");
+	CHECK(names[second] == "second");
+
+	for (std::size_t position = 0; position < names.size(); ++position) CHECK(names[names.handle_at(position)] == names.values()[position]);
+
+	CHECK(!names.contains(name_handle {}));
+	CHECK(names.find(name_handle {}) == nullptr);
+	CHECK(!names.erase(name_handle {}));
+
+	names.clear();
+	CHECK(names.empty());
+	CHECK(!names.contains(second));
+	CHECK(!names.contains(third));
+}
+
+void test_stale_handles() {
+	name_map names;
+
+	const name_handle stale = names.insert("erased");
+	CHECK(names.erase(stale));
+
+	// The slot is reused with a new generation, so the old handle does not match its new value.
+	const name_handle reused = names.insert("reused");
+
+	CHECK(reused.index() == stale.index());
+	CHECK(reused.generation() != stale.generation());
+	CHECK(!names.contains(stale));
+	CHECK(names.find(stale) == nullptr);
+	CHECK(test::asserts([&] { [[maybe_unused]] const std::string& value = names[stale]; }));
+	CHECK(!names.erase(stale));
+	CHECK(names[reused] == "reused");
+}
+
+void test_generation_wrap() {
+	name_map names;
+
+	const name_handle stale = names.insert("stale");
+	const name_handle other = names.insert("other");
+
+	CHECK(names.erase(stale));
+
+	// 255 more reuses bring the generation of the slot back to that of [stale], while the slot is free.
+	for (std::size_t cycle = 1; cycle < (std::size_t {1} << name_handle::generation_bits); ++cycle) {
+		const name_handle reused = names.insert("cycle");
+
+		CHECK(reused.index() == stale.index());
+		CHECK(names.erase(reused));
+	}
+
+	CHECK(!names.contains(stale));
+	CHECK(names.find(stale) == nullptr);
+	CHECK(!names.erase(stale));
+	CHECK(names.size() == 1);
+	CHECK(names[other] == "other");
+
+	// Reusing the slot once more matches [stale] again: the documented limit of the generation bits.
+	const name_handle wrapped = names.insert("wrapped");
+
+	CHECK(wrapped == stale);
+	CHECK(names[stale] == "wrapped");
+}
+
+int main() {
+	test_insert_find_erase();
+	test_stale_handles();
+	test_generation_wrap();
+
+	return test::result();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdio>
+#include <utility>
+
+/*
+	test.hpp description:
+		This header file contains a minimal test harness shared by the strict_types
+		tests. CHECK() reports a failed condition and keeps going, and main() returns
+		test::result(), which is non-zero if any check failed.
+
+		It defines STRICT_TYPES_ASSERT to record failed library assertions instead of
+		aborting, so preconditions can be tested with test::asserts(). It must therefore
+		be included before any strict_types header.
+*/
+
+namespace test {
+	inline int	failures				= 0;
+	inline bool assertion_failed	= false;
+
+	/// @brief Reports [expression] at [file]:[line] if [condition] is false.
+	inline void check(const bool condition, const char* const expression, const char* const file, const int line) noexcept {
+		if (condition) return;
+
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+		++failures;
+	}
+
+	/// @brief Returns true if calling [callable] failed a STRICT_TYPES_ASSERT.
+	/// @tparam Callable The tested callable, invoked without arguments.
+	/// @returns bool
+	template <typename Callable>
+	[[nodiscard]] inline bool asserts(Callable&& callable) {
+		assertion_failed = false;
+		callable();
+
+		return std::exchange(assertion_failed, false);
+	}
+
+	/// @brief Prints the number of failed checks.
+	/// @returns int The exit code: 0 if every check passed, 1 otherwise.
+	[[nodiscard]] inline int result() noexcept {
+		if (failures != 0) std::fprintf(stderr, "%d check(s) failed\n", failures);
+
+		return failures == 0 ? 0 : 1;
+	}
+}
+
+#define STRICT_TYPES_ASSERT(CONDITION, MESSAGE) (static_cast<bool>(CONDITION) ? static_cast<void>(0) : static_cast<void>(test::assertion_failed = true))
+
+#define CHECK(...) test::check(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)